@@ -0,0 +1,34 @@
+/**
+ ******************************************************************************
+ * @file    isp_algo_cct.h
+ * @author  AIS Application Team
+ * @brief   Header file of the Correlated Color Temperature estimation
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __ISP_ALGO_CCT__H
+#define __ISP_ALGO_CCT__H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+uint32_t ISP_Algo_CCT_Estimate(uint8_t r, uint8_t g, uint8_t b);
+
+/* Exported variables --------------------------------------------------------*/
+
+#endif /* __ISP_ALGO_CCT__H */
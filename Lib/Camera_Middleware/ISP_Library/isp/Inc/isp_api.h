@@ -36,9 +36,11 @@ ISP_StatusTypeDef ISP_DeInit(ISP_HandleTypeDef *hIsp);
 ISP_StatusTypeDef ISP_Start(ISP_HandleTypeDef *hIsp);
 ISP_StatusTypeDef ISP_BackgroundProcess(ISP_HandleTypeDef *hIsp);
 ISP_StatusTypeDef ISP_SetApplicationCB(ISP_HandleTypeDef *hIsp, ISP_AppliCBTypeDef *pAppliCB);
+ISP_StatusTypeDef ISP_SetEventCB(ISP_HandleTypeDef *hIsp, ISP_EventCBTypeDef EventCB, void *pContext);
 
 ISP_StatusTypeDef ISP_SetExposureTarget(ISP_HandleTypeDef *hIsp, ISP_ExposureCompTypeDef ExposureCompensation);
 ISP_StatusTypeDef ISP_GetExposureTarget(ISP_HandleTypeDef *hIsp, ISP_ExposureCompTypeDef *pExposureCompensation, uint32_t *pExposureTarget);
+ISP_StatusTypeDef ISP_SetMeteringROI(ISP_HandleTypeDef *hIsp, ISP_MeteringTypeDef *pMetering);
 ISP_StatusTypeDef ISP_ListWBRefModes(ISP_HandleTypeDef *hIsp, uint32_t RefColorTemp[]);
 ISP_StatusTypeDef ISP_SetWBRefMode(ISP_HandleTypeDef *hIsp, uint8_t Automatic, uint32_t RefColorTemp);
 ISP_StatusTypeDef ISP_GetWBRefMode(ISP_HandleTypeDef *hIsp, uint8_t *pAutomatic, uint32_t *pRefColorTemp);
@@ -27,5 +27,6 @@
 /* Exported macro ------------------------------------------------------------*/
 /* Exported functions ------------------------------------------------------- */
 ISP_StatusTypeDef ISP_CmdParser_ProcessCommand(ISP_HandleTypeDef *hIsp, uint8_t *cmd);
+void ISP_CmdParser_Poll(ISP_HandleTypeDef *hIsp);
 
 #endif
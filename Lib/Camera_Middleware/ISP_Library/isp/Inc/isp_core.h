@@ -91,6 +91,15 @@ typedef struct
   uint32_t YSize;
 } ISP_StatAreaTypeDef;
 
+/* ISP metering regions of interest: the AEC weights their luminance against the stat area one */
+#define ISP_METERING_ROI_MAX  (4U)
+typedef struct
+{
+  uint32_t nbROI;                               /* Number of regions in ROI[], 0 to meter the stat area only */
+  ISP_StatAreaTypeDef ROI[ISP_METERING_ROI_MAX]; /* Regions, in the same referential as the stat area */
+  uint32_t weightROI;                           /* Weight (0 to 100) of the regions average luminance */
+} ISP_MeteringTypeDef;
+
 /* ISP algo state */
 typedef enum
 {
@@ -205,6 +214,13 @@ typedef struct
   ISP_StatusTypeDef (*StatAreaUpdated)(ISP_StatAreaTypeDef area);
 } ISP_AppliCBTypeDef;
 
+/* ISP events requiring a run of the background process */
+#define ISP_EVENT_FRAME  (1U << 0) /* A frame has been output on the main pipe */
+#define ISP_EVENT_STATS  (1U << 1) /* A statistics gathering step has been done */
+
+/* ISP event callback, called from the DCMIPP interrupt context with a combination of ISP_EVENT_xxx */
+typedef void (*ISP_EventCBTypeDef)(void *pContext, uint32_t events);
+
 /* ISP Device handle structure */
 typedef struct
 {
@@ -217,6 +233,9 @@ typedef struct
   uint32_t MainPipe_FrameCount;
   uint32_t AncillaryPipe_FrameCount;
   uint32_t DumpPipe_FrameCount;
+  uint32_t LastProcessedFrameId;
+  ISP_EventCBTypeDef eventCB;
+  void *eventContext;
 } ISP_HandleTypeDef;
 
 /* ISP Demosaicing type */
@@ -39,6 +39,12 @@ typedef enum {
   ISP_STAT_TYPE_ALL_TMP      = 0x01U << 2, /* special value for IQTuningTool usage */
 } ISP_SVC_StatType;
 
+typedef struct {
+  uint8_t averageL;           /* Average luminance of the metering region */
+  uint8_t globalL;            /* Down average luminance of the gather cycle where the region was measured */
+  uint32_t frameId;           /* Frame id of the measure, 0 if not measured yet */
+} ISP_SVC_RoiStatTypeDef;
+
 typedef struct {
   ISP_StatisticsTypeDef up;   /* Statistics collected at the up side of the ISP pipeline */
   ISP_StatisticsTypeDef down; /* Statistics collected at the down side of the ISP pipeline */
@@ -46,6 +52,9 @@ typedef struct {
   uint32_t upFrameIdEnd;      /* Frame id of the last frame of the gather cycle at up side */
   uint32_t downFrameIdStart;  /* Frame id of the first frame of the gather cycle at down side */
   uint32_t downFrameIdEnd;    /* Frame id of the last frame of the gather cycle at down side */
+  uint32_t nbROI;             /* Number of metering regions (see ISP_SVC_Stats_SetMetering) */
+  uint32_t weightROI;         /* Weight (0 to 100) of the metering regions luminance */
+  ISP_SVC_RoiStatTypeDef roi[ISP_METERING_ROI_MAX]; /* Down average luminance of the metering regions */
 } ISP_SVC_StatStateTypeDef;
 
 typedef ISP_StatusTypeDef (*ISP_stat_ready_cb)(ISP_AlgoTypeDef *pAlgo);
@@ -112,5 +121,7 @@ ISP_StatusTypeDef ISP_SVC_Stats_GetNext(ISP_HandleTypeDef *hIsp, ISP_stat_ready_
                                         ISP_SVC_StatLocation location, ISP_SVC_StatType type, uint32_t frameDelay);
 ISP_StatusTypeDef ISP_SVC_Stats_ProcessCallbacks(ISP_HandleTypeDef *hIsp);
 void ISP_SVC_Stats_Gather(ISP_HandleTypeDef *hIsp);
+ISP_StatusTypeDef ISP_SVC_Stats_SetMetering(ISP_HandleTypeDef *hIsp, ISP_MeteringTypeDef *pMetering);
+uint8_t ISP_SVC_Stats_GetMeteredLuminance(ISP_SVC_StatStateTypeDef *pStats);
 
 #endif /* __ISP_SERVICES__H */
@@ -0,0 +1,56 @@
+/**
+ ******************************************************************************
+ * @file    isp_threadx.h
+ * @author  AIS Application Team
+ * @brief   Header file of the ISP background process ThreadX service
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __ISP_THREADX__H
+#define __ISP_THREADX__H
+
+#ifdef ISP_MW_THREADX_SUPPORT
+
+/* Includes ------------------------------------------------------------------*/
+#include "isp_core.h"
+#include "tx_api.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* ISP ThreadX service handle: one per ISP device */
+typedef struct
+{
+  TX_THREAD thread;             /* Must be the first member: the thread entry gets the service from it */
+  TX_EVENT_FLAGS_GROUP events;
+  ISP_HandleTypeDef *hIsp;
+  ISP_StatusTypeDef lastStatus; /* Status of the last failed ISP_BackgroundProcess() */
+  uint32_t processCount;        /* Number of ISP_BackgroundProcess() runs */
+} ISP_ThreadX_ServiceTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Period (in ticks) of the tuning tool command check when no ISP event is received */
+#ifndef ISP_THREADX_TOOL_POLL_TICKS
+#define ISP_THREADX_TOOL_POLL_TICKS 10U
+#endif
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+ISP_StatusTypeDef ISP_ThreadX_Start(ISP_ThreadX_ServiceTypeDef *hService, ISP_HandleTypeDef *hIsp,
+                                    void *pStack, uint32_t StackSize, uint32_t Priority);
+ISP_StatusTypeDef ISP_ThreadX_Stop(ISP_ThreadX_ServiceTypeDef *hService);
+
+/* Exported variables --------------------------------------------------------*/
+
+#endif /* ISP_MW_THREADX_SUPPORT */
+
+#endif /* __ISP_THREADX__H */
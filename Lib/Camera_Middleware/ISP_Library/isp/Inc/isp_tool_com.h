@@ -30,5 +30,10 @@ void ISP_ToolCom_ReceivedCb(uint8_t *buffer, uint32_t buffer_size);
 void ISP_ToolCom_SendData(uint8_t *buffer, uint32_t buffer_size, char *dump_start_msg,  char *dump_stop_msg);
 uint32_t ISP_ToolCom_CheckCommandReceived(uint8_t **block_cmd);
 void ISP_ToolCom_PrepareNextCommand();
+#ifdef ISP_MW_TOOL_FRAMING_SUPPORT
+void ISP_ToolCom_SendFrame(uint8_t type, uint8_t flags, uint8_t *buffer, uint32_t buffer_size);
+void ISP_ToolCom_TransmitCpltCb(void);
+void ISP_ToolCom_WaitTxIdle(void);
+#endif
 
 #endif
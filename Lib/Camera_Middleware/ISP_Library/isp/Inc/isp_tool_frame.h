@@ -0,0 +1,70 @@
+/**
+  ******************************************************************************
+  * @file    isp_tool_frame.h
+  * @author  AIS Application Team
+  * @brief   Header file of the binary framing of the IQ tuning tool transport
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2023 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __ISP_TOOL_FRAME_H
+#define __ISP_TOOL_FRAME_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+/* Frame payload type */
+typedef enum
+{
+  ISP_TOOL_FRAME_CMD          = 0x00U,  /* Command answer (ISP_Cmd_TypeDef) */
+  ISP_TOOL_FRAME_DUMP         = 0x01U,  /* Part of a frame dump */
+  ISP_TOOL_FRAME_STATS        = 0x02U,  /* Batch of statistics records */
+} ISP_ToolFrame_TypeTypeDef;
+
+/* Frame header, serialized little endian on ISP_TOOL_FRAME_HEADER_SIZE bytes */
+typedef struct
+{
+  uint8_t type;               /* ISP_ToolFrame_TypeTypeDef */
+  uint8_t flags;              /* ISP_TOOL_FRAME_FLAG_xxx and delta stride */
+  uint16_t seq;               /* Sequence number, to detect lost frames */
+  uint32_t size;              /* Payload size on the link */
+  uint32_t rawSize;           /* Payload size once decoded */
+} ISP_ToolFrame_HeaderTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+#define ISP_TOOL_FRAME_MAGIC0            ((uint8_t) 'I')
+#define ISP_TOOL_FRAME_MAGIC1            ((uint8_t) 'Q')
+#define ISP_TOOL_FRAME_HEADER_SIZE       (16U)
+
+/* Flags */
+#define ISP_TOOL_FRAME_FLAG_DELTA_RLE    (0x01U)  /* Payload is delta + run length encoded */
+#define ISP_TOOL_FRAME_FLAG_FIRST        (0x02U)  /* First frame of a split payload */
+#define ISP_TOOL_FRAME_FLAG_LAST         (0x04U)  /* Last frame of a split payload */
+#define ISP_TOOL_FRAME_STRIDE_Pos        (4U)     /* Delta distance in bytes (1 to 15): 2 for RAW8 Bayer, ... */
+#define ISP_TOOL_FRAME_STRIDE_Msk        (0xF0U)
+
+/* Stats batch payload: a 4 bytes header (record count, record size) then the records */
+#define ISP_TOOL_FRAME_STATS_HEADER_SIZE (4U)
+
+/* Exported macro ------------------------------------------------------------*/
+#define ISP_TOOL_FRAME_STRIDE(s)         ((uint8_t) (((s) << ISP_TOOL_FRAME_STRIDE_Pos) & ISP_TOOL_FRAME_STRIDE_Msk))
+
+/* Exported functions ------------------------------------------------------- */
+uint32_t ISP_ToolFrame_Encode(uint8_t *pOut, uint32_t outSize, const ISP_ToolFrame_HeaderTypeDef *pHeader,
+                              const uint8_t *pIn);
+int32_t ISP_ToolFrame_ParseHeader(const uint8_t *pIn, ISP_ToolFrame_HeaderTypeDef *pHeader);
+uint32_t ISP_ToolFrame_Decode(const ISP_ToolFrame_HeaderTypeDef *pHeader, const uint8_t *pIn, uint8_t *pOut,
+                              uint32_t outSize);
+
+#endif /* __ISP_TOOL_FRAME_H */
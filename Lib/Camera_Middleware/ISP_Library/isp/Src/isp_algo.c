@@ -20,6 +20,7 @@
 #include "isp_core.h"
 #include "isp_algo.h"
 #include "isp_services.h"
+#include "isp_algo_cct.h"
 #include "evision-api-ae.h"
 #include "evision-api-awb.h"
 #include "evision-api-utils.h"
@@ -981,7 +982,8 @@ ISP_StatusTypeDef ISP_Algo_AEC_Process(void *hIsp, void *pAlgo)
   case ISP_ALGO_STATE_STAT_READY:
     /* Align on the target update (may have been updated with ISP_SetExposureTarget()) */
     pIspAECestimator->hyper_params.desired_luminosity = IQParamConfig->AECAlgo.exposureTarget;
-    ccAvgL = (double)stats.down.averageL;
+    /* Down average luminance, weighted with the metering regions one if set with ISP_SetMeteringROI() */
+    ccAvgL = (double)ISP_SVC_Stats_GetMeteredLuminance(&stats);
 #ifdef ALGO_AEC_DBG_LOGS
     if (ccAvgL != currentL)
     {
@@ -1365,83 +1367,6 @@ ISP_StatusTypeDef ISP_Algo_AWB_Process(void *hIsp, void *pAlgo)
   return ret;
 }
 
-/**
-  * @brief  ISP_Algo_SimpleAWB_CCT_LinearSrgb
-  *         Convert sRGB component to linear value
-  * @param  c:   sRGB component
-  * @retval linear component
-  */
-static double_t ISP_Algo_SimpleAWB_CCT_LinearSrgb(double c)
-{
-  double linh;
-
-  if (c <= 0.04045)
-  {
-    linh = c / 12.92;
-  }
-  else
-  {
-    linh = pow((c + 0.055) / 1.055, 2.4);
-  }
-  return linh;
-}
-
-/**
-  * @brief  ISP_Algo_SimpleAWB_CCT_ComputeCCT
-  *         Estimate Correlated Color Temperature from rgb using McCamy's formula
-  * @param  r: Red component
-  * @param  g: Green component
-  * @param  b: Blue component
-  * @retval Correlated Color Temperature in °K
-  */
-static double_t ISP_Algo_SimpleAWB_CCT_ComputeCCT(uint8_t r, uint8_t g, uint8_t b)
-{
-  /* Correlation matrix used in order to convert RBG values to XYZ space */
-  /* Illuminant = D65      RGB (R709) [sRGB or HDTV] to XYZ */
-  const double_t Cx[] = {0.4124, 0.3576, 0.1805};
-  const double_t Cy[] = {0.2126, 0.7152, 0.0722};
-  const double_t Cz[] = {0.0193, 0.1192, 0.9505};
-  uint8_t i;
-  double_t data[3], xyNormFactor, m_xNormCoeff, m_yNormCoeff, nCoeff, cct;
-  double_t X_tmp = 0, Y_tmp = 0, Z_tmp = 0;
-
-  /* Normalize and prepare RGB channels values for cct computation */
-  data[0] = ISP_Algo_SimpleAWB_CCT_LinearSrgb(r / 255.0);
-  data[1] = ISP_Algo_SimpleAWB_CCT_LinearSrgb(g / 255.0);
-  data[2] = ISP_Algo_SimpleAWB_CCT_LinearSrgb(b / 255.0);
-
-  /* Apply correlation matrix to RGB channels to obtain (X,Y,Z) */
-  for (i = 0; i < 3; i++)
-  {
-    X_tmp += Cx[i] * data[i];
-    Y_tmp += Cy[i] * data[i];
-    Z_tmp += Cz[i] * data[i];
-  }
-
-  /* Transform (X,Y,Z) to (x,y) */
-  xyNormFactor = X_tmp + Y_tmp + Z_tmp;
-  m_xNormCoeff = X_tmp / xyNormFactor;
-  m_yNormCoeff = Y_tmp / xyNormFactor;
-
-  /* Apply McCamy's formula to obtain CCT value */
-  nCoeff = (m_xNormCoeff - 0.3320) / (0.1858 - m_yNormCoeff);
-  cct = (449 * pow(nCoeff, 3) + 3525 * pow(nCoeff, 2) + 6823.3 * nCoeff + 5520.33);
-
-  return cct;
-}
-
-/**
-  * @brief  ISP_Algo_SimpleAWB_CCT_FixCCT
-  *         Get the expected color temperature (from experiments with IMX335 sensor) from the theoretical computed value
-  * @param  cct: theoretical correlated color temperature
-  * @retval Correlated Color Temperature corrected
-  */
-static double_t ISP_Algo_SimpleAWB_CCT_FixCCT(double cct)
-{
-  /* Correction = 0.0005517 CCT² – 4.597 CCT + 12208 */
-  return 0.0005517 * cct * cct -4.597 * cct + 12208;
-}
-
 /**
   * @brief  ISP_Algo_SimpleAWB_CCT_StatNoGain
   *         Get the RGB stats "before" ISP Gain block
@@ -1591,7 +1516,6 @@ ISP_StatusTypeDef ISP_Algo_SimpleAWB_CCT_Process(void *hIsp, void *pAlgo)
   ISP_AlgoTypeDef *algo = (ISP_AlgoTypeDef *)pAlgo;
   ISP_IQParamTypeDef *IQParamConfig;
   ISP_StatusTypeDef ret = ISP_OK;
-  double cct;
   uint32_t noGainR, noGainG, noGainB, fixedCCT, distance, colorTemp;
   uint32_t profId, bestProfId, bestNbSel;
   static uint32_t colorTempCurrent, preventUpdate, nbSelection[ISP_AWB_COLORTEMP_REF];
@@ -1633,13 +1557,16 @@ ISP_StatusTypeDef ISP_Algo_SimpleAWB_CCT_Process(void *hIsp, void *pAlgo)
       /* Get RGB before ISP gain */
       ISP_Algo_SimpleAWB_CCT_StatNoGain(hIsp, stats.down.averageR, stats.down.averageG, stats.down.averageB, &noGainR, &noGainG, &noGainB);
 
-      /* Get CCT from McCamy’s approximation */
-      cct = ISP_Algo_SimpleAWB_CCT_ComputeCCT(noGainR, noGainG, noGainB);
-
-      /* Fix the computed CCT to match IMX335 experimentations */
-      fixedCCT = (uint32_t) ISP_Algo_SimpleAWB_CCT_FixCCT(cct);
+      /* Get CCT from McCamy’s approximation, fixed to match IMX335 experimentations */
+      fixedCCT = ISP_Algo_CCT_Estimate((uint8_t) noGainR, (uint8_t) noGainG, (uint8_t) noGainB);
+      if (fixedCCT == 0)
+      {
+        /* No reliable estimation from these stats: keep the current profile and ask for new stats */
+        algo->state = ISP_ALGO_STATE_NEED_STAT;
+        break;
+      }
 #ifdef ALGO_AWB_CCT_DBG_LOGS
-      //printf("CCT_corrected = %ld \t CCT=%f \t R=%03ld G=%03ld B=%03ld\r\n", fixedCCT, cct, noGainR, noGainG, noGainB);
+      //printf("CCT_corrected = %ld \t R=%03ld G=%03ld B=%03ld\r\n", fixedCCT, noGainR, noGainG, noGainB);
 #endif
       /* Find the index of the closest profile matching this color temperature */
       distance = UINT_MAX;
@@ -0,0 +1,300 @@
+/**
+ ******************************************************************************
+ * @file    isp_algo_cct.c
+ * @author  AIS Application Team
+ * @brief   Correlated Color Temperature estimation of the SimpleAWB_CCT algorithm
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "isp_algo_cct.h"
+#include <math.h>
+
+/* Private types -------------------------------------------------------------*/
+/* Private constants ---------------------------------------------------------*/
+/* Range and number of intervals of the precomputed corrected CCT curve */
+#define ALGO_AWB_CCT_CURVE_N_MIN (-1.0f)
+#define ALGO_AWB_CCT_CURVE_N_MAX (1.0f)
+#define ALGO_AWB_CCT_CURVE_SIZE  256
+
+/* Highest estimation returned, larger values are reported as not estimated */
+#define ALGO_AWB_CCT_MAX         1000000.0f
+
+/* Uncomment to estimate the AWB CCT with the double precision reference implementation */
+//#define ALGO_AWB_CCT_DOUBLE_REF
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/* Private functions ---------------------------------------------------------*/
+#ifdef ALGO_AWB_CCT_DOUBLE_REF
+/**
+  * @brief  ISP_Algo_SimpleAWB_CCT_LinearSrgb
+  *         Convert sRGB component to linear value
+  * @param  c:   sRGB component
+  * @retval linear component
+  */
+static double_t ISP_Algo_SimpleAWB_CCT_LinearSrgb(double c)
+{
+  double linh;
+
+  if (c <= 0.04045)
+  {
+    linh = c / 12.92;
+  }
+  else
+  {
+    linh = pow((c + 0.055) / 1.055, 2.4);
+  }
+  return linh;
+}
+
+/**
+  * @brief  ISP_Algo_SimpleAWB_CCT_ComputeCCT
+  *         Estimate Correlated Color Temperature from rgb using McCamy's formula
+  * @param  r: Red component
+  * @param  g: Green component
+  * @param  b: Blue component
+  * @retval Correlated Color Temperature in °K
+  */
+static double_t ISP_Algo_SimpleAWB_CCT_ComputeCCT(uint8_t r, uint8_t g, uint8_t b)
+{
+  /* Correlation matrix used in order to convert RBG values to XYZ space */
+  /* Illuminant = D65      RGB (R709) [sRGB or HDTV] to XYZ */
+  const double_t Cx[] = {0.4124, 0.3576, 0.1805};
+  const double_t Cy[] = {0.2126, 0.7152, 0.0722};
+  const double_t Cz[] = {0.0193, 0.1192, 0.9505};
+  uint8_t i;
+  double_t data[3], xyNormFactor, m_xNormCoeff, m_yNormCoeff, nCoeff, cct;
+  double_t X_tmp = 0, Y_tmp = 0, Z_tmp = 0;
+
+  /* Normalize and prepare RGB channels values for cct computation */
+  data[0] = ISP_Algo_SimpleAWB_CCT_LinearSrgb(r / 255.0);
+  data[1] = ISP_Algo_SimpleAWB_CCT_LinearSrgb(g / 255.0);
+  data[2] = ISP_Algo_SimpleAWB_CCT_LinearSrgb(b / 255.0);
+
+  /* Apply correlation matrix to RGB channels to obtain (X,Y,Z) */
+  for (i = 0; i < 3; i++)
+  {
+    X_tmp += Cx[i] * data[i];
+    Y_tmp += Cy[i] * data[i];
+    Z_tmp += Cz[i] * data[i];
+  }
+
+  /* Transform (X,Y,Z) to (x,y) */
+  xyNormFactor = X_tmp + Y_tmp + Z_tmp;
+  m_xNormCoeff = X_tmp / xyNormFactor;
+  m_yNormCoeff = Y_tmp / xyNormFactor;
+
+  /* Apply McCamy's formula to obtain CCT value */
+  nCoeff = (m_xNormCoeff - 0.3320) / (0.1858 - m_yNormCoeff);
+  cct = (449 * pow(nCoeff, 3) + 3525 * pow(nCoeff, 2) + 6823.3 * nCoeff + 5520.33);
+
+  return cct;
+}
+
+/**
+  * @brief  ISP_Algo_SimpleAWB_CCT_FixCCT
+  *         Get the expected color temperature (from experiments with IMX335 sensor) from the theoretical computed value
+  * @param  cct: theoretical correlated color temperature
+  * @retval Correlated Color Temperature corrected
+  */
+static double_t ISP_Algo_SimpleAWB_CCT_FixCCT(double cct)
+{
+  /* Correction = 0.0005517 CCT² – 4.597 CCT + 12208 */
+  return 0.0005517 * cct * cct -4.597 * cct + 12208;
+}
+
+/**
+  * @brief  ISP_Algo_CCT_Estimate
+  *         Estimate the corrected Correlated Color Temperature from rgb using McCamy's formula
+  *         and the correction from experiments with IMX335 sensor.
+  * @param  r: Red component
+  * @param  g: Green component
+  * @param  b: Blue component
+  * @retval Correlated Color Temperature corrected in °K, 0 if it can not be estimated
+  */
+uint32_t ISP_Algo_CCT_Estimate(uint8_t r, uint8_t g, uint8_t b)
+{
+  double_t cct;
+
+  cct = ISP_Algo_SimpleAWB_CCT_FixCCT(ISP_Algo_SimpleAWB_CCT_ComputeCCT(r, g, b));
+
+  /* Reject black and near-singular inputs (NaN, infinite or out of range results) */
+  if (!(cct >= 1.0) || !(cct <= ALGO_AWB_CCT_MAX))
+  {
+    return 0;
+  }
+
+  return (uint32_t) cct;
+}
+#else
+/* Linearised (sRGB-decoded) value of each 8-bit component: ISP_Algo_SimpleAWB_CCT_LinearSrgb(c / 255).
+ * Generated by ../tools/awb_cct/awb_cct_tables.py */
+static const float ISP_Algo_SimpleAWB_CCT_LinearSrgbLUT[256] = {
+  0.00000000e+00f, 3.03526984e-04f, 6.07053967e-04f, 9.10580951e-04f, 1.21410793e-03f, 1.51763492e-03f, 1.82116190e-03f, 2.12468888e-03f,
+  2.42821587e-03f, 2.73174285e-03f, 3.03526984e-03f, 3.34653576e-03f, 3.67650732e-03f, 4.02471702e-03f, 4.39144204e-03f, 4.77695348e-03f,
+  5.18151670e-03f, 5.60539162e-03f, 6.04883302e-03f, 6.51209079e-03f, 6.99541019e-03f, 7.49903204e-03f, 8.02319299e-03f, 8.56812562e-03f,
+  9.13405870e-03f, 9.72121732e-03f, 1.03298230e-02f, 1.09600940e-02f, 1.16122452e-02f, 1.22864884e-02f, 1.29830323e-02f, 1.37020830e-02f,
+  1.44438436e-02f, 1.52085144e-02f, 1.59962934e-02f, 1.68073758e-02f, 1.76419545e-02f, 1.85002201e-02f, 1.93823610e-02f, 2.02885631e-02f,
+  2.12190104e-02f, 2.21738848e-02f, 2.31533662e-02f, 2.41576324e-02f, 2.51868596e-02f, 2.62412219e-02f, 2.73208916e-02f, 2.84260395e-02f,
+  2.95568344e-02f, 3.07134437e-02f, 3.18960331e-02f, 3.31047666e-02f, 3.43398068e-02f, 3.56013149e-02f, 3.68894504e-02f, 3.82043716e-02f,
+  3.95462353e-02f, 4.09151969e-02f, 4.23114106e-02f, 4.37350293e-02f, 4.51862044e-02f, 4.66650863e-02f, 4.81718242e-02f, 4.97065660e-02f,
+  5.12694584e-02f, 5.28606470e-02f, 5.44802764e-02f, 5.61284900e-02f, 5.78054302e-02f, 5.95112382e-02f, 6.12460542e-02f, 6.30100177e-02f,
+  6.48032667e-02f, 6.66259386e-02f, 6.84781698e-02f, 7.03600957e-02f, 7.22718507e-02f, 7.42135684e-02f, 7.61853815e-02f, 7.81874218e-02f,
+  8.02198203e-02f, 8.22827071e-02f, 8.43762115e-02f, 8.65004620e-02f, 8.86555863e-02f, 9.08417112e-02f, 9.30589628e-02f, 9.53074666e-02f,
+  9.75873471e-02f, 9.98987282e-02f, 1.02241733e-01f, 1.04616484e-01f, 1.07023103e-01f, 1.09461711e-01f, 1.11932428e-01f, 1.14435374e-01f,
+  1.16970668e-01f, 1.19538428e-01f, 1.22138772e-01f, 1.24771818e-01f, 1.27437680e-01f, 1.30136477e-01f, 1.32868322e-01f, 1.35633330e-01f,
+  1.38431615e-01f, 1.41263291e-01f, 1.44128471e-01f, 1.47027266e-01f, 1.49959790e-01f, 1.52926152e-01f, 1.55926464e-01f, 1.58960835e-01f,
+  1.62029376e-01f, 1.65132195e-01f, 1.68269400e-01f, 1.71441101e-01f, 1.74647404e-01f, 1.77888416e-01f, 1.81164244e-01f, 1.84474995e-01f,
+  1.87820772e-01f, 1.91201683e-01f, 1.94617830e-01f, 1.98069320e-01f, 2.01556254e-01f, 2.05078736e-01f, 2.08636870e-01f, 2.12230757e-01f,
+  2.15860500e-01f, 2.19526200e-01f, 2.23227957e-01f, 2.26965874e-01f, 2.30740049e-01f, 2.34550582e-01f, 2.38397574e-01f, 2.42281122e-01f,
+  2.46201327e-01f, 2.50158285e-01f, 2.54152094e-01f, 2.58182853e-01f, 2.62250658e-01f, 2.66355605e-01f, 2.70497791e-01f, 2.74677312e-01f,
+  2.78894263e-01f, 2.83148740e-01f, 2.87440838e-01f, 2.91770650e-01f, 2.96138271e-01f, 3.00543794e-01f, 3.04987314e-01f, 3.09468923e-01f,
+  3.13988713e-01f, 3.18546778e-01f, 3.23143209e-01f, 3.27778098e-01f, 3.32451536e-01f, 3.37163615e-01f, 3.41914425e-01f, 3.46704056e-01f,
+  3.51532600e-01f, 3.56400144e-01f, 3.61306780e-01f, 3.66252596e-01f, 3.71237680e-01f, 3.76262123e-01f, 3.81326011e-01f, 3.86429434e-01f,
+  3.91572478e-01f, 3.96755231e-01f, 4.01977780e-01f, 4.07240212e-01f, 4.12542613e-01f, 4.17885071e-01f, 4.23267670e-01f, 4.28690497e-01f,
+  4.34153636e-01f, 4.39657174e-01f, 4.45201195e-01f, 4.50785783e-01f, 4.56411023e-01f, 4.62077000e-01f, 4.67783796e-01f, 4.73531496e-01f,
+  4.79320183e-01f, 4.85149940e-01f, 4.91020850e-01f, 4.96932995e-01f, 5.02886458e-01f, 5.08881321e-01f, 5.14917665e-01f, 5.20995573e-01f,
+  5.27115126e-01f, 5.33276404e-01f, 5.39479489e-01f, 5.45724461e-01f, 5.52011402e-01f, 5.58340390e-01f, 5.64711506e-01f, 5.71124829e-01f,
+  5.77580440e-01f, 5.84078418e-01f, 5.90618841e-01f, 5.97201788e-01f, 6.03827339e-01f, 6.10495571e-01f, 6.17206562e-01f, 6.23960392e-01f,
+  6.30757136e-01f, 6.37596874e-01f, 6.44479682e-01f, 6.51405637e-01f, 6.58374817e-01f, 6.65387298e-01f, 6.72443157e-01f, 6.79542470e-01f,
+  6.86685312e-01f, 6.93871761e-01f, 7.01101892e-01f, 7.08375780e-01f, 7.15693501e-01f, 7.23055129e-01f, 7.30460740e-01f, 7.37910409e-01f,
+  7.45404210e-01f, 7.52942217e-01f, 7.60524505e-01f, 7.68151147e-01f, 7.75822218e-01f, 7.83537792e-01f, 7.91297940e-01f, 7.99102738e-01f,
+  8.06952258e-01f, 8.14846572e-01f, 8.22785754e-01f, 8.30769877e-01f, 8.38799012e-01f, 8.46873232e-01f, 8.54992608e-01f, 8.63157213e-01f,
+  8.71367119e-01f, 8.79622397e-01f, 8.87923118e-01f, 8.96269353e-01f, 9.04661174e-01f, 9.13098652e-01f, 9.21581856e-01f, 9.30110858e-01f,
+  9.38685728e-01f, 9.47306537e-01f, 9.55973353e-01f, 9.64686248e-01f, 9.73445290e-01f, 9.82250550e-01f, 9.91102097e-01f, 1.00000000e+00f
+};
+
+/* Corrected color temperature ISP_Algo_SimpleAWB_CCT_FixCCT(McCamy(n)) sampled on McCamy's n, from
+ * ALGO_AWB_CCT_CURVE_N_MIN to ALGO_AWB_CCT_CURVE_N_MAX. Generated by ../tools/awb_cct/awb_cct_tables.py */
+static const float ISP_Algo_SimpleAWB_CCT_FixedCurve[ALGO_AWB_CCT_CURVE_SIZE + 1] = {
+  5791.72f, 5768.30f, 5744.27f, 5719.63f, 5694.39f, 5668.54f, 5642.11f, 5615.09f,
+  5587.49f, 5559.31f, 5530.57f, 5501.27f, 5471.41f, 5441.02f, 5410.08f, 5378.62f,
+  5346.64f, 5314.15f, 5281.16f, 5247.68f, 5213.72f, 5179.29f, 5144.40f, 5109.07f,
+  5073.30f, 5037.10f, 5000.50f, 4963.49f, 4926.11f, 4888.35f, 4850.23f, 4811.77f,
+  4772.98f, 4733.88f, 4694.48f, 4654.80f, 4614.86f, 4574.66f, 4534.24f, 4493.60f,
+  4452.77f, 4411.77f, 4370.60f, 4329.30f, 4287.88f, 4246.36f, 4204.77f, 4163.13f,
+  4121.45f, 4079.76f, 4038.08f, 3996.44f, 3954.86f, 3913.36f, 3871.97f, 3830.72f,
+  3789.62f, 3748.71f, 3708.02f, 3667.56f, 3627.38f, 3587.49f, 3547.93f, 3508.72f,
+  3469.90f, 3431.49f, 3393.54f, 3356.06f, 3319.09f, 3282.67f, 3246.83f, 3211.61f,
+  3177.02f, 3143.13f, 3109.95f, 3077.52f, 3045.89f, 3015.09f, 2985.16f, 2956.13f,
+  2928.05f, 2900.96f, 2874.90f, 2849.91f, 2826.03f, 2803.31f, 2781.78f, 2761.50f,
+  2742.50f, 2724.84f, 2708.56f, 2693.71f, 2680.33f, 2668.47f, 2658.18f, 2649.52f,
+  2642.53f, 2637.26f, 2633.77f, 2632.10f, 2632.32f, 2634.47f, 2638.61f, 2644.80f,
+  2653.09f, 2663.54f, 2676.21f, 2691.16f, 2708.44f, 2728.12f, 2750.25f, 2774.91f,
+  2802.14f, 2832.03f, 2864.62f, 2899.99f, 2938.20f, 2979.32f, 3023.42f, 3070.56f,
+  3120.81f, 3174.25f, 3230.94f, 3290.97f, 3354.39f, 3421.28f, 3491.73f, 3565.80f,
+  3643.57f, 3725.12f, 3810.53f, 3899.87f, 3993.23f, 4090.69f, 4192.32f, 4298.22f,
+  4408.46f, 4523.14f, 4642.33f, 4766.13f, 4894.61f, 5027.88f, 5166.02f, 5309.12f,
+  5457.27f, 5610.56f, 5769.10f, 5932.97f, 6102.27f, 6277.09f, 6457.54f, 6643.72f,
+  6835.72f, 7033.64f, 7237.59f, 7447.67f, 7663.98f, 7886.64f, 8115.74f, 8351.39f,
+  8593.71f, 8842.79f, 9098.77f, 9361.73f, 9631.81f, 9909.11f, 10193.74f, 10485.83f,
+  10785.50f, 11092.85f, 11408.02f, 11731.12f, 12062.28f, 12401.61f, 12749.25f, 13105.32f,
+  13469.94f, 13843.25f, 14225.38f, 14616.46f, 15016.61f, 15425.97f, 15844.69f, 16272.88f,
+  16710.70f, 17158.27f, 17615.75f, 18083.26f, 18560.95f, 19048.98f, 19547.47f, 20056.58f,
+  20576.45f, 21107.24f, 21649.10f, 22202.17f, 22766.61f, 23342.57f, 23930.22f, 24529.70f,
+  25141.17f, 25764.80f, 26400.75f, 27049.18f, 27710.25f, 28384.13f, 29070.99f, 29770.99f,
+  30484.31f, 31211.11f, 31951.58f, 32705.87f, 33474.18f, 34256.67f, 35053.53f, 35864.93f,
+  36691.06f, 37532.11f, 38388.24f, 39259.66f, 40146.55f, 41049.10f, 41967.50f, 42901.94f,
+  43852.62f, 44819.74f, 45803.48f, 46804.05f, 47821.65f, 48856.48f, 49908.75f, 50978.66f,
+  52066.41f, 53172.22f, 54296.30f, 55438.85f, 56600.10f, 57780.25f, 58979.53f, 60198.15f,
+  61436.34f, 62694.30f, 63972.28f, 65270.49f, 66589.16f, 67928.53f, 69288.81f, 70670.24f,
+  72073.07f, 73497.51f, 74943.82f, 76412.23f, 77902.98f, 79416.31f, 80952.48f, 82511.72f,
+  84094.28f
+};
+
+/**
+  * @brief  ISP_Algo_SimpleAWB_CCT_ComputeN
+  *         Compute the n coefficient of McCamy's formula from rgb
+  * @param  r: Red component
+  * @param  g: Green component
+  * @param  b: Blue component
+  * @retval McCamy's n coefficient
+  */
+static float ISP_Algo_SimpleAWB_CCT_ComputeN(uint8_t r, uint8_t g, uint8_t b)
+{
+  /* Correlation matrix used in order to convert RBG values to XYZ space */
+  /* Illuminant = D65      RGB (R709) [sRGB or HDTV] to XYZ */
+  /* n = (x - 0.3320) / (0.1858 - y) with (x,y) = (X,Y) / (X + Y + Z) is folded into the matrix:
+   * Cn = Cx - 0.3320 (Cx + Cy + Cz) and Cd = 0.1858 (Cx + Cy + Cz) - Cy, so that n = (Cn.rgb) / (Cd.rgb) */
+  const float Cn[] = {0.1984924f, -0.038144f, -0.2189624f};
+  const float Cd[] = {-0.09288906f, -0.4937264f, 0.15135456f};
+  uint8_t i;
+  float data[3];
+  float num = 0, den = 0;
+
+  /* Get linear RGB channels values from the look-up table */
+  data[0] = ISP_Algo_SimpleAWB_CCT_LinearSrgbLUT[r];
+  data[1] = ISP_Algo_SimpleAWB_CCT_LinearSrgbLUT[g];
+  data[2] = ISP_Algo_SimpleAWB_CCT_LinearSrgbLUT[b];
+
+  for (i = 0; i < 3; i++)
+  {
+    num += Cn[i] * data[i];
+    den += Cd[i] * data[i];
+  }
+
+  return num / den;
+}
+
+/**
+  * @brief  ISP_Algo_CCT_Estimate
+  *         Estimate the corrected Correlated Color Temperature from rgb using McCamy's formula
+  *         and the correction from experiments with IMX335 sensor.
+  * @param  r: Red component
+  * @param  g: Green component
+  * @param  b: Blue component
+  * @retval Correlated Color Temperature corrected in °K, 0 if it can not be estimated
+  */
+uint32_t ISP_Algo_CCT_Estimate(uint8_t r, uint8_t g, uint8_t b)
+{
+  float nCoeff, pos, cct;
+  uint32_t idx;
+
+  nCoeff = ISP_Algo_SimpleAWB_CCT_ComputeN(r, g, b);
+
+  if ((nCoeff >= ALGO_AWB_CCT_CURVE_N_MIN) && (nCoeff < ALGO_AWB_CCT_CURVE_N_MAX))
+  {
+    /* Linear interpolation in the precomputed curve */
+    pos = (nCoeff - ALGO_AWB_CCT_CURVE_N_MIN) * (ALGO_AWB_CCT_CURVE_SIZE / (ALGO_AWB_CCT_CURVE_N_MAX - ALGO_AWB_CCT_CURVE_N_MIN));
+    idx = (uint32_t) pos;
+    if (idx >= ALGO_AWB_CCT_CURVE_SIZE)
+    {
+      /* nCoeff just below ALGO_AWB_CCT_CURVE_N_MAX may round up to the last sample */
+      idx = ALGO_AWB_CCT_CURVE_SIZE - 1;
+      pos = 1.0f;
+    }
+    else
+    {
+      pos -= (float) idx;
+    }
+    cct = ISP_Algo_SimpleAWB_CCT_FixedCurve[idx] +
+          pos * (ISP_Algo_SimpleAWB_CCT_FixedCurve[idx + 1] - ISP_Algo_SimpleAWB_CCT_FixedCurve[idx]);
+  }
+  else
+  {
+    /* Out of the curve range: McCamy's formula then correction = 0.0005517 CCT² – 4.597 CCT + 12208 */
+    cct = ((449.0f * nCoeff + 3525.0f) * nCoeff + 6823.3f) * nCoeff + 5520.33f;
+    cct = (0.0005517f * cct - 4.597f) * cct + 12208.0f;
+  }
+
+  /* Reject black and near-singular inputs (NaN, infinite or out of range results) */
+  if (!(cct >= 1.0f) || !(cct <= ALGO_AWB_CCT_MAX))
+  {
+    return 0;
+  }
+
+  return (uint32_t) cct;
+}
+#endif /* ALGO_AWB_CCT_DOUBLE_REF */
@@ -23,6 +23,9 @@
 #include "isp_cmd_parser.h"
 #include "isp_tool_com.h"
 #include "isp_services.h"
+#ifdef ISP_MW_TOOL_FRAMING_SUPPORT
+#include "isp_tool_frame.h"
+#endif
 
 /* Private types -------------------------------------------------------------*/
 typedef enum {
@@ -268,20 +271,53 @@ typedef union {
   ISP_CMD_SensorTestPatternTypeDef  sensorTestPattern;
 } ISP_Cmd_TypeDef;
 
+#ifdef ISP_MW_TOOL_FRAMING_SUPPORT
+/* Statistics event sent in an ISP_TOOL_FRAME_STATS batch */
+typedef struct
+{
+  ISP_Cmd_HeaderTypeDef header;
+  uint32_t frameId;
+  ISP_StatisticsTypeDef data;
+} ISP_Cmd_StatRecordTypeDef;
+#endif
+
 /* Private constants ---------------------------------------------------------*/
 #define ISP_MAX_DUMP_SIZE         4096
 #define ISP_DUMP_DATA_STR         "DUMP DATA"
 
+#ifdef ISP_MW_TOOL_FRAMING_SUPPORT
+/* Statistics events sent in one frame at most */
+#ifndef ISP_CMD_STATS_BATCH_MAX
+#define ISP_CMD_STATS_BATCH_MAX   (8U)
+#endif
+/* Number of frames a statistics event may wait for other ones before its batch is sent */
+#ifndef ISP_CMD_STATS_BATCH_DELAY
+#define ISP_CMD_STATS_BATCH_DELAY (0U)
+#endif
+#endif
+
 /* Private macro -------------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
 static ISP_StatusTypeDef ISP_CmdParser_SetConfig(ISP_HandleTypeDef *hIsp, uint8_t *cmd);
 static ISP_StatusTypeDef ISP_CmdParser_GetConfig(ISP_HandleTypeDef *hIsp, uint8_t *cmd);
-static void ISP_CmdParser_SendDumpData(uint8_t* pFrame, uint32_t size);
+static void ISP_CmdParser_SendDumpData(uint8_t* pFrame, ISP_DumpFrameMetaTypeDef *pMeta);
+static void ISP_CmdParser_SendAnswer(ISP_Cmd_TypeDef *cmd, uint32_t size);
 static ISP_StatusTypeDef ISP_CmdParser_StatUpCb(ISP_AlgoTypeDef *pAlgo);
 static ISP_StatusTypeDef ISP_CmdParser_StatDownCb(ISP_AlgoTypeDef *pAlgo);
+#ifdef ISP_MW_TOOL_FRAMING_SUPPORT
+static void ISP_CmdParser_SendStats(void);
+#endif
 
 /* Private variables ---------------------------------------------------------*/
 static ISP_SVC_StatStateTypeDef ISP_CmdParser_stats;
+#ifdef ISP_MW_TOOL_FRAMING_SUPPORT
+static struct
+{
+  uint16_t count;
+  uint16_t recordSize;
+  ISP_Cmd_StatRecordTypeDef record[ISP_CMD_STATS_BATCH_MAX];
+} ISP_CmdParser_statBatch;
+#endif
 
 extern uint32_t current_awb_profId;
 
@@ -554,7 +590,7 @@ static ISP_StatusTypeDef ISP_CmdParser_SetConfig(ISP_HandleTypeDef *hIsp, uint8_
     base_cmd.base.header.dummy[0] = ret;
   }
 
-  ISP_ToolCom_SendData((uint8_t*)&base_cmd, sizeof(base_cmd), NULL, NULL);
+  ISP_CmdParser_SendAnswer(&base_cmd, sizeof(base_cmd));
 
   return ret;
 }
@@ -713,28 +749,66 @@ static ISP_StatusTypeDef ISP_CmdParser_GetConfig(ISP_HandleTypeDef *hIsp, uint8_
   if (!((cmd_id == ISP_CMD_STATISTICUP || cmd_id == ISP_CMD_STATISTICDOWN) && (ret == ISP_OK)))
   {
     /* Send command answer (except for statistic where the answer is sent upon callback call */
-    ISP_ToolCom_SendData((uint8_t*)&c, sizeof(c), NULL, NULL);
+    ISP_CmdParser_SendAnswer(&c, sizeof(c));
   }
 
   /* Send dump buffer if requested  */
   if ((cmd_id == ISP_CMD_DUMPFRAME) && (ret == ISP_OK))
   {
-    ISP_CmdParser_SendDumpData((uint8_t*)pFrame, c.dumpFrameMeta.data.size);
+    ISP_CmdParser_SendDumpData((uint8_t*)pFrame, &c.dumpFrameMeta.data);
   }
 
   return ret;
 }
 
+/**
+  * @brief  ISP_CmdParser_SendAnswer
+  *         Send a command answer
+  * @param  cmd: Pointer to the answer
+  * @param  size: Size of the answer
+  * @retval None
+  */
+static void ISP_CmdParser_SendAnswer(ISP_Cmd_TypeDef *cmd, uint32_t size)
+{
+#ifdef ISP_MW_TOOL_FRAMING_SUPPORT
+  /* Keep the statistics events before the answer */
+  ISP_CmdParser_SendStats();
+  ISP_ToolCom_SendFrame(ISP_TOOL_FRAME_CMD, 0, (uint8_t*)cmd, size);
+#else
+  ISP_ToolCom_SendData((uint8_t*)cmd, size, NULL, NULL);
+#endif
+}
+
 /**
   * @brief  ISP_CmdParser_SendDumpData
   *         Send dump frame data, splitting it in several parts if too large
   * @param  pFrame: Pointer to data to send
-  * @param  size: Size of data to send
+  * @param  pMeta: Pointer to the frame meta data
   * @retval None
   */
-static void ISP_CmdParser_SendDumpData(uint8_t* pFrame, uint32_t size)
+static void ISP_CmdParser_SendDumpData(uint8_t* pFrame, ISP_DumpFrameMetaTypeDef *pMeta)
 {
-  uint32_t sizeToSend, remaining = size;
+#ifdef ISP_MW_TOOL_FRAMING_SUPPORT
+  uint8_t stride;
+
+  /* Delta between the same components: Bayer pattern period for raw (2 pixels of 1 or 2 bytes), 1 pixel for RGB */
+  switch (pMeta->format)
+  {
+  case ISP_FORMAT_RGB888:
+    stride = 3;
+    break;
+  case ISP_FORMAT_RAW8:
+    stride = 2;
+    break;
+  default:
+    stride = 4;
+    break;
+  }
+
+  ISP_ToolCom_SendFrame(ISP_TOOL_FRAME_DUMP, ISP_TOOL_FRAME_FLAG_DELTA_RLE | ISP_TOOL_FRAME_STRIDE(stride), pFrame,
+                        pMeta->size);
+#else
+  uint32_t sizeToSend, size = pMeta->size, remaining = size;
   uint8_t first = true;
   char dump_start_msg[32];
   char dump_stop_msg[32];
@@ -772,8 +846,58 @@ static void ISP_CmdParser_SendDumpData(uint8_t* pFrame, uint32_t size)
     sprintf(dump_stop_msg, "%s]", ISP_DUMP_DATA_STR);
     ISP_ToolCom_SendData((uint8_t*)pFrame, size, dump_start_msg, dump_stop_msg);
   }
+#endif
 }
 
+#ifdef ISP_MW_TOOL_FRAMING_SUPPORT
+/**
+  * @brief  ISP_CmdParser_AddStats
+  *         Add a statistics event to the batch, sending the batch when full
+  * @param  id: ISP_CMD_STATISTICUP or ISP_CMD_STATISTICDOWN
+  * @param  frameId: Id of the last frame of the statistics cycle
+  * @param  pStats: Pointer to the statistics
+  * @retval None
+  */
+static void ISP_CmdParser_AddStats(uint8_t id, uint32_t frameId, ISP_StatisticsTypeDef *pStats)
+{
+  ISP_Cmd_StatRecordTypeDef *record;
+
+  record = &ISP_CmdParser_statBatch.record[ISP_CmdParser_statBatch.count++];
+  memset(record, 0, sizeof(*record));
+  record->header.id = id;
+  record->header.operation = ISP_CMD_OP_GET_OK;
+  record->frameId = frameId;
+  record->data = *pStats;
+
+  if (ISP_CmdParser_statBatch.count == ISP_CMD_STATS_BATCH_MAX)
+  {
+    ISP_CmdParser_SendStats();
+  }
+}
+
+/**
+  * @brief  ISP_CmdParser_SendStats
+  *         Send the batched statistics events, if any, in one frame
+  * @param  None
+  * @retval None
+  */
+static void ISP_CmdParser_SendStats(void)
+{
+  uint32_t count = ISP_CmdParser_statBatch.count;
+
+  if (count == 0)
+  {
+    return;
+  }
+
+  ISP_CmdParser_statBatch.recordSize = sizeof(ISP_Cmd_StatRecordTypeDef);
+  ISP_ToolCom_SendFrame(ISP_TOOL_FRAME_STATS, ISP_TOOL_FRAME_FLAG_DELTA_RLE | ISP_TOOL_FRAME_STRIDE(4),
+                        (uint8_t*)&ISP_CmdParser_statBatch,
+                        ISP_TOOL_FRAME_STATS_HEADER_SIZE + count * sizeof(ISP_Cmd_StatRecordTypeDef));
+  ISP_CmdParser_statBatch.count = 0;
+}
+#endif
+
 /**
   * @brief  ISP_CmdParser_StatUpCb
   *         Callback called when statistics at Up are available
@@ -782,6 +906,9 @@ static void ISP_CmdParser_SendDumpData(uint8_t* pFrame, uint32_t size)
   */
 static ISP_StatusTypeDef ISP_CmdParser_StatUpCb(ISP_AlgoTypeDef *pAlgo)
 {
+#ifdef ISP_MW_TOOL_FRAMING_SUPPORT
+  ISP_CmdParser_AddStats(ISP_CMD_STATISTICUP, ISP_CmdParser_stats.upFrameIdEnd, &ISP_CmdParser_stats.up);
+#else
   ISP_Cmd_TypeDef cmd = { 0 };
 
   /* Send the answer command */
@@ -790,6 +917,7 @@ static ISP_StatusTypeDef ISP_CmdParser_StatUpCb(ISP_AlgoTypeDef *pAlgo)
   cmd.statisticsUp.data = ISP_CmdParser_stats.up;
 
   ISP_ToolCom_SendData((uint8_t*)&cmd, sizeof(cmd), NULL, NULL);
+#endif
 
   return ISP_OK;
 }
@@ -802,6 +930,9 @@ static ISP_StatusTypeDef ISP_CmdParser_StatUpCb(ISP_AlgoTypeDef *pAlgo)
   */
 static ISP_StatusTypeDef ISP_CmdParser_StatDownCb(ISP_AlgoTypeDef *pAlgo)
 {
+#ifdef ISP_MW_TOOL_FRAMING_SUPPORT
+  ISP_CmdParser_AddStats(ISP_CMD_STATISTICDOWN, ISP_CmdParser_stats.downFrameIdEnd, &ISP_CmdParser_stats.down);
+#else
   ISP_Cmd_TypeDef cmd = { 0 };
 
   /* Send the answer command */
@@ -810,8 +941,34 @@ static ISP_StatusTypeDef ISP_CmdParser_StatDownCb(ISP_AlgoTypeDef *pAlgo)
   cmd.statisticsUp.data = ISP_CmdParser_stats.down;
 
   ISP_ToolCom_SendData((uint8_t*)&cmd, sizeof(cmd), NULL, NULL);
+#endif
 
   return ISP_OK;
 }
 
+/**
+  * @brief  ISP_CmdParser_Poll
+  *         Send the statistics events batched for more than ISP_CMD_STATS_BATCH_DELAY frames.
+  *         To be called by the background process after the statistics callbacks.
+  * @param  hIsp: ISP device handle
+  * @retval None
+  */
+void ISP_CmdParser_Poll(ISP_HandleTypeDef *hIsp)
+{
+#ifdef ISP_MW_TOOL_FRAMING_SUPPORT
+#if ISP_CMD_STATS_BATCH_DELAY > 0
+  if ((ISP_CmdParser_statBatch.count > 0) &&
+      (ISP_SVC_Misc_GetMainFrameId(hIsp) - ISP_CmdParser_statBatch.record[0].frameId < ISP_CMD_STATS_BATCH_DELAY))
+  {
+    return;
+  }
+#else
+  (void)hIsp;
+#endif
+  ISP_CmdParser_SendStats();
+#else
+  (void)hIsp;
+#endif
+}
+
 #endif /* ISP_MW_TUNING_TOOL_SUPPORT */
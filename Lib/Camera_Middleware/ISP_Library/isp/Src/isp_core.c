@@ -315,13 +315,13 @@ ISP_StatusTypeDef ISP_Start(ISP_HandleTypeDef *hIsp)
 
 /**
   * @brief  ISP_BackgroundProcess
-  *         Run the background process of the ISP device
+  *         Run the background process of the ISP device. It can be either polled from the main loop
+  *         or called only when the event callback (see ISP_SetEventCB) has reported new data.
   * @param  hIsp: ISP device handle
   * @retval ISP status
   */
 ISP_StatusTypeDef ISP_BackgroundProcess(ISP_HandleTypeDef *hIsp)
 {
-  static uint32_t LastFrameId;
   uint32_t CurrentFrameId;
   ISP_StatusTypeDef retCmdParser = ISP_OK, retAlgo = ISP_OK, retStats = ISP_OK;
 #ifdef ISP_MW_TUNING_TOOL_SUPPORT
@@ -343,11 +343,16 @@ ISP_StatusTypeDef ISP_BackgroundProcess(ISP_HandleTypeDef *hIsp)
   /* Check if a statistics gathering cycle has been completed to call the statistic callbacks */
   retStats = ISP_SVC_Stats_ProcessCallbacks(hIsp);
 
+#ifdef ISP_MW_TUNING_TOOL_SUPPORT
+  /* Send the statistics events batched by the callbacks */
+  ISP_CmdParser_Poll(hIsp);
+#endif
+
   CurrentFrameId = ISP_SVC_Misc_GetMainFrameId(hIsp);
-  if (CurrentFrameId != LastFrameId)
+  if (CurrentFrameId != hIsp->LastProcessedFrameId)
   {
     /* A new frame has been received : process the algorithms */
-    LastFrameId = CurrentFrameId;
+    hIsp->LastProcessedFrameId = CurrentFrameId;
     retAlgo = ISP_Algo_Process(hIsp);
   }
 
@@ -380,6 +385,27 @@ ISP_StatusTypeDef ISP_SetApplicationCB(ISP_HandleTypeDef *hIsp, ISP_AppliCBTypeD
   return ISP_OK;
 }
 
+/**
+  * @brief  ISP_SetEventCB
+  *         Register the callback informing that the background process has new data to handle.
+  *         It is called from interrupt context, typically to wake up an RTOS task running ISP_BackgroundProcess.
+  * @param  hIsp: ISP device handle
+  * @param  EventCB: Event callback, NULL to unregister
+  * @param  pContext: Parameter passed to the event callback
+  * @retval Operation status
+  */
+ISP_StatusTypeDef ISP_SetEventCB(ISP_HandleTypeDef *hIsp, ISP_EventCBTypeDef EventCB, void *pContext)
+{
+  if (hIsp == NULL)
+  {
+    return ISP_ERR_EINVAL;
+  }
+
+  hIsp->eventContext = pContext;
+  hIsp->eventCB = EventCB;
+  return ISP_OK;
+}
+
 /**
   * @brief  ISP_SetExposureTarget
   *         Update the exposure target used by the AEC algorithm
@@ -416,6 +442,24 @@ ISP_StatusTypeDef ISP_GetExposureTarget(ISP_HandleTypeDef *hIsp, ISP_ExposureCom
   return ISP_OK;
 }
 
+/**
+  * @brief  ISP_SetMeteringROI
+  *         Set the regions of interest (e.g. detected objects) on which the AEC algorithm meters the luminance,
+  *         in addition to the statistic area. One region is measured per statistic cycle.
+  * @param  hIsp: ISP device handle
+  * @param  pMetering: Pointer to the metering regions, with coordinates in the statistic area referential
+  * @retval Operation status
+  */
+ISP_StatusTypeDef ISP_SetMeteringROI(ISP_HandleTypeDef *hIsp, ISP_MeteringTypeDef *pMetering)
+{
+  if ((hIsp == NULL) || (pMetering == NULL))
+  {
+    return ISP_ERR_EINVAL;
+  }
+
+  return ISP_SVC_Stats_SetMetering(hIsp, pMetering);
+}
+
 /**
   * @brief  ISP_ListWBRefModes
   *         List the reference modes (color temperature) that define a white balance configuration
@@ -544,6 +588,11 @@ ISP_StatusTypeDef ISP_GetWBRefMode(ISP_HandleTypeDef *hIsp, uint8_t *pAutomatic,
 void ISP_GatherStatistics(ISP_HandleTypeDef *hIsp)
 {
   ISP_SVC_Stats_Gather(hIsp);
+
+  if (hIsp->eventCB != NULL)
+  {
+    hIsp->eventCB(hIsp->eventContext, ISP_EVENT_STATS);
+  }
 }
 
 /**
@@ -555,6 +604,11 @@ void ISP_GatherStatistics(ISP_HandleTypeDef *hIsp)
 void ISP_IncMainFrameId(ISP_HandleTypeDef *hIsp)
 {
   ISP_SVC_Misc_IncMainFrameId(hIsp);
+
+  if (hIsp->eventCB != NULL)
+  {
+    hIsp->eventCB(hIsp->eventContext, ISP_EVENT_FRAME);
+  }
 }
 
 /**
@@ -42,6 +42,8 @@ typedef enum {
   ISP_STAT_CFG_DOWN_BINS_9_11,  /* Configure @Down for bins[9:11] */
   ISP_STAT_CFG_LAST = ISP_STAT_CFG_DOWN_BINS_9_11,
   ISP_STAT_CFG_CYCLE_SIZE,
+  ISP_STAT_CFG_DOWN_AVG_ROI = ISP_STAT_CFG_CYCLE_SIZE, /* Configure @Down for average on a metering region.
+                                                          Ends the down cycle when metering regions are set */
 } ISP_SVC_StatEngineStage;
 
 typedef enum {
@@ -68,10 +70,19 @@ typedef struct {
   ISP_SVC_StatType upRequest;           /* Type of statistics request at Up location */
   ISP_SVC_StatType downRequest;         /* Type of statistics request at Down location */
   uint32_t requestAllCounter;           /* Counter for the temporary "request all stats" mode */
+  ISP_MeteringTypeDef metering[2];      /* Metering regions: the active ones and the ones being set */
+  uint32_t meteringActive;              /* Index of the active metering regions */
+  volatile uint32_t meteringUpdate;     /* 1 + index of the metering regions to activate, 0 if none */
+  uint32_t roiNext;                     /* Metering region measured at the next DOWN_AVG_ROI stage */
+  ISP_SVC_RoiStatTypeDef roi[ISP_METERING_ROI_MAX]; /* Last measure of each metering region */
 } ISP_SVC_StatEngineTypeDef;
 
 /* Private constants ---------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
+#ifndef __COMPILER_BARRIER
+#define __COMPILER_BARRIER() __asm volatile("" ::: "memory")
+#endif
+
 /* Private function prototypes -----------------------------------------------*/
 static void To_Shift_Multiplier(uint32_t Factor, uint8_t *pShift, uint8_t *pMultiplier);
 static uint32_t From_Shift_Multiplier(uint8_t Shift, uint8_t Multiplier);
@@ -188,12 +199,12 @@ static int32_t From_CConv_Reg(int16_t Reg)
   return (int32_t) Val;
 }
 
-static uint8_t GetAvgStats(ISP_HandleTypeDef *hIsp, ISP_SVC_StatLocation location, ISP_SVC_Component component, uint32_t accu)
+static uint8_t GetAvgStats(ISP_StatAreaTypeDef *pArea, ISP_SVC_StatLocation location, ISP_SVC_Component component, uint32_t accu)
 {
   uint32_t nb_comp_pix, comp_divider;
 
   /* Number of pixels computed from Stat Area and considering decimation */
-  nb_comp_pix = hIsp->statArea.XSize * hIsp->statArea.YSize;
+  nb_comp_pix = pArea->XSize * pArea->YSize;
   nb_comp_pix /= ISP_DecimationValue.factor * ISP_DecimationValue.factor;
 
   if (location == ISP_STAT_LOC_DOWN)
@@ -223,6 +234,28 @@ static void ReadStatHistogram(ISP_HandleTypeDef *hIsp, uint32_t *histogram)
   }
 }
 
+static HAL_StatusTypeDef SetStatAreaConfig(ISP_HandleTypeDef *hIsp, ISP_StatAreaTypeDef *pArea)
+{
+  DCMIPP_StatisticExtractionAreaConfTypeDef statAreaCfg;
+
+  /* Set coordinates in the 'decimated' referential */
+  statAreaCfg.HStart = pArea->X0 / ISP_DecimationValue.factor;
+  statAreaCfg.VStart = pArea->Y0 / ISP_DecimationValue.factor;
+  statAreaCfg.HSize = pArea->XSize / ISP_DecimationValue.factor;
+  statAreaCfg.VSize = pArea->YSize / ISP_DecimationValue.factor;
+
+  return HAL_DCMIPP_PIPE_SetISPAreaStatisticExtractionConfig(hIsp->hDcmipp, DCMIPP_PIPE1, &statAreaCfg);
+}
+
+static bool IsMeteringActive(void)
+{
+  /* Metering regions are measured with the down average, except in the IQ tuning tool "all stats" mode */
+  return (ISP_SVC_StatEngine.metering[ISP_SVC_StatEngine.meteringActive].nbROI != 0) &&
+         (ISP_SVC_StatEngine.downRequest & ISP_STAT_TYPE_AVG) &&
+         !(ISP_SVC_StatEngine.upRequest & ISP_STAT_TYPE_ALL_TMP) &&
+         !(ISP_SVC_StatEngine.downRequest & ISP_STAT_TYPE_ALL_TMP);
+}
+
 static void SetStatConfig(DCMIPP_StatisticExtractionConfTypeDef *statConf, const DCMIPP_StatisticExtractionConfTypeDef *refConfig)
 {
   for (int i = 0; i < 3; i++)
@@ -243,6 +276,20 @@ static ISP_SVC_StatEngineStage GetNextStatStage(ISP_SVC_StatEngineStage current)
     return next;
   }
 
+  /* With metering regions, one region is measured after the last down measurement: this adds a single
+   * stage to the down cycle whatever the number of regions.
+   */
+  if (current == ISP_STAT_CFG_DOWN_AVG_ROI)
+  {
+    /* Leave the down side as after its last bins measurement */
+    current = ISP_STAT_CFG_DOWN_BINS_9_11;
+  }
+  else if (IsMeteringActive() &&
+           (current == ((ISP_SVC_StatEngine.downRequest & ISP_STAT_TYPE_BINS) ? ISP_STAT_CFG_DOWN_BINS_9_11 : ISP_STAT_CFG_DOWN_AVG)))
+  {
+    return ISP_STAT_CFG_DOWN_AVG_ROI;
+  }
+
   /* Follow the below stage cycle, skipping steps where stats are not requested:
    * - ISP_STAT_CFG_UP_AVG
    * - ISP_STAT_CFG_UP_BINS_0_2 + BINS_3_5 + BINS_6_8 + BINS_9_11
@@ -407,8 +454,13 @@ static ISP_SVC_StatEngineStage GetStatCycleEnd(ISP_SVC_StatLocation location)
   }
   else
   {
-    if ((ISP_SVC_StatEngine.downRequest & ISP_STAT_TYPE_BINS) ||
-        (ISP_SVC_StatEngine.downRequest & ISP_STAT_TYPE_ALL_TMP))
+    if (IsMeteringActive())
+    {
+      /* Stat down cycle ends with a metering region measurement */
+      stage = ISP_STAT_CFG_DOWN_AVG_ROI;
+    }
+    else if ((ISP_SVC_StatEngine.downRequest & ISP_STAT_TYPE_BINS) ||
+             (ISP_SVC_StatEngine.downRequest & ISP_STAT_TYPE_ALL_TMP))
     {
       /* Stat down cycle ends with last BINS measurement */
       stage = ISP_STAT_CFG_DOWN_BINS_9_11;
@@ -1651,9 +1703,12 @@ ISP_IQParamTypeDef *ISP_SVC_IQParam_Get(ISP_HandleTypeDef *hIsp)
 void ISP_SVC_Stats_Gather(ISP_HandleTypeDef *hIsp)
 {
   static ISP_SVC_StatEngineStage stagePrevious1 = ISP_STAT_CFG_LAST, stagePrevious2 = ISP_STAT_CFG_LAST;
+  static uint32_t roiPrevious1 = ISP_METERING_ROI_MAX, roiPrevious2 = ISP_METERING_ROI_MAX;
   DCMIPP_StatisticExtractionConfTypeDef statConf[3];
   ISP_SVC_StatStateTypeDef *ongoing;
-  uint32_t i, avgR, avgG, avgB, frameId;
+  ISP_MeteringTypeDef *metering;
+  ISP_SVC_RoiStatTypeDef *roi;
+  uint32_t i, avgR, avgG, avgB, frameId, roiCurrent = ISP_METERING_ROI_MAX;
 
   /* Check handle validity */
   if (hIsp == NULL)
@@ -1662,6 +1717,23 @@ void ISP_SVC_Stats_Gather(ISP_HandleTypeDef *hIsp)
     return;
   }
 
+  /* Take the metering regions set by the application. Measures in progress on the previous ones are dropped */
+  if (ISP_SVC_StatEngine.meteringUpdate != 0)
+  {
+    ISP_SVC_StatEngine.meteringActive = ISP_SVC_StatEngine.meteringUpdate - 1;
+    ISP_SVC_StatEngine.meteringUpdate = 0;
+    ISP_SVC_StatEngine.roiNext = 0;
+    memset(ISP_SVC_StatEngine.roi, 0, sizeof(ISP_SVC_StatEngine.roi));
+    roiPrevious1 = ISP_METERING_ROI_MAX;
+    roiPrevious2 = ISP_METERING_ROI_MAX;
+
+    if ((ISP_SVC_StatEngine.stage == ISP_STAT_CFG_DOWN_AVG_ROI) && !IsMeteringActive())
+    {
+      ISP_SVC_StatEngine.stage = GetNextStatStage(ISP_SVC_StatEngine.stage);
+    }
+  }
+  metering = &ISP_SVC_StatEngine.metering[ISP_SVC_StatEngine.meteringActive];
+
   /* Read the stats according to the configuration applied 2 VSYNC (shadow register + stat computation)
    * stages earlier.
    */
@@ -1673,9 +1745,9 @@ void ISP_SVC_Stats_Gather(ISP_HandleTypeDef *hIsp)
     HAL_DCMIPP_PIPE_GetISPAccumulatedStatisticsCounter(hIsp->hDcmipp, DCMIPP_PIPE1, DCMIPP_STATEXT_MODULE2, &avgG);
     HAL_DCMIPP_PIPE_GetISPAccumulatedStatisticsCounter(hIsp->hDcmipp, DCMIPP_PIPE1, DCMIPP_STATEXT_MODULE3, &avgB);
 
-    ongoing->up.averageR = GetAvgStats(hIsp, ISP_STAT_LOC_UP, ISP_RED, avgR);
-    ongoing->up.averageG = GetAvgStats(hIsp, ISP_STAT_LOC_UP, ISP_GREEN, avgG);
-    ongoing->up.averageB = GetAvgStats(hIsp, ISP_STAT_LOC_UP, ISP_BLUE, avgB);
+    ongoing->up.averageR = GetAvgStats(&hIsp->statArea, ISP_STAT_LOC_UP, ISP_RED, avgR);
+    ongoing->up.averageG = GetAvgStats(&hIsp->statArea, ISP_STAT_LOC_UP, ISP_GREEN, avgG);
+    ongoing->up.averageB = GetAvgStats(&hIsp->statArea, ISP_STAT_LOC_UP, ISP_BLUE, avgB);
     ongoing->up.averageL = LuminanceFromRGB(ongoing->up.averageR, ongoing->up.averageG, ongoing->up.averageB);
     break;
 
@@ -1700,9 +1772,9 @@ void ISP_SVC_Stats_Gather(ISP_HandleTypeDef *hIsp)
     HAL_DCMIPP_PIPE_GetISPAccumulatedStatisticsCounter(hIsp->hDcmipp, DCMIPP_PIPE1, DCMIPP_STATEXT_MODULE2, &avgG);
     HAL_DCMIPP_PIPE_GetISPAccumulatedStatisticsCounter(hIsp->hDcmipp, DCMIPP_PIPE1, DCMIPP_STATEXT_MODULE3, &avgB);
 
-    ongoing->down.averageR = GetAvgStats(hIsp, ISP_STAT_LOC_DOWN, ISP_RED, avgR);
-    ongoing->down.averageG = GetAvgStats(hIsp, ISP_STAT_LOC_DOWN, ISP_GREEN, avgG);
-    ongoing->down.averageB = GetAvgStats(hIsp, ISP_STAT_LOC_DOWN, ISP_BLUE, avgB);
+    ongoing->down.averageR = GetAvgStats(&hIsp->statArea, ISP_STAT_LOC_DOWN, ISP_RED, avgR);
+    ongoing->down.averageG = GetAvgStats(&hIsp->statArea, ISP_STAT_LOC_DOWN, ISP_GREEN, avgG);
+    ongoing->down.averageB = GetAvgStats(&hIsp->statArea, ISP_STAT_LOC_DOWN, ISP_BLUE, avgB);
     ongoing->down.averageL = LuminanceFromRGB(ongoing->down.averageR, ongoing->down.averageG, ongoing->down.averageB);
 
     break;
@@ -1723,6 +1795,22 @@ void ISP_SVC_Stats_Gather(ISP_HandleTypeDef *hIsp)
     ReadStatHistogram(hIsp, &ongoing->down.histogram[9]);
     break;
 
+  case ISP_STAT_CFG_DOWN_AVG_ROI:
+    if (roiPrevious2 < metering->nbROI)
+    {
+      HAL_DCMIPP_PIPE_GetISPAccumulatedStatisticsCounter(hIsp->hDcmipp, DCMIPP_PIPE1, DCMIPP_STATEXT_MODULE1, &avgR);
+      HAL_DCMIPP_PIPE_GetISPAccumulatedStatisticsCounter(hIsp->hDcmipp, DCMIPP_PIPE1, DCMIPP_STATEXT_MODULE2, &avgG);
+      HAL_DCMIPP_PIPE_GetISPAccumulatedStatisticsCounter(hIsp->hDcmipp, DCMIPP_PIPE1, DCMIPP_STATEXT_MODULE3, &avgB);
+
+      roi = &ISP_SVC_StatEngine.roi[roiPrevious2];
+      roi->averageL = LuminanceFromRGB(GetAvgStats(&metering->ROI[roiPrevious2], ISP_STAT_LOC_DOWN, ISP_RED, avgR),
+                                       GetAvgStats(&metering->ROI[roiPrevious2], ISP_STAT_LOC_DOWN, ISP_GREEN, avgG),
+                                       GetAvgStats(&metering->ROI[roiPrevious2], ISP_STAT_LOC_DOWN, ISP_BLUE, avgB));
+      roi->globalL = ongoing->down.averageL;
+      roi->frameId = ISP_SVC_Misc_GetMainFrameId(hIsp);
+    }
+    break;
+
   default:
     /* No Read */
     break;
@@ -1781,11 +1869,45 @@ void ISP_SVC_Stats_Gather(ISP_HandleTypeDef *hIsp)
     SetStatConfig(statConf, &statConfDownBins_9_11);
     break;
 
+  case ISP_STAT_CFG_DOWN_AVG_ROI:
+    for (i = 0; i < 3; i++)
+    {
+      statConf[i].Mode = DCMIPP_STAT_EXT_MODE_AVERAGE;
+      statConf[i].Source = avgRGBDown[i];
+      statConf[i].Bins = DCMIPP_STAT_EXT_AVER_MODE_ALL_PIXELS;
+    }
+
+    /* Measure the metering regions in turn */
+    if (ISP_SVC_StatEngine.roiNext >= metering->nbROI)
+    {
+      ISP_SVC_StatEngine.roiNext = 0;
+    }
+    roiCurrent = ISP_SVC_StatEngine.roiNext++;
+    break;
+
   default:
     /* Configure Unchanged */
     break;
   }
 
+  /* Move the stat area on the metering region, and back to the whole stat area after */
+  if (roiCurrent != ISP_METERING_ROI_MAX)
+  {
+    if (SetStatAreaConfig(hIsp, &metering->ROI[roiCurrent]) != HAL_OK)
+    {
+      printf("ERROR: can't set Statistic Area config\r\n");
+      return;
+    }
+  }
+  else if (stagePrevious1 == ISP_STAT_CFG_DOWN_AVG_ROI)
+  {
+    if (SetStatAreaConfig(hIsp, &hIsp->statArea) != HAL_OK)
+    {
+      printf("ERROR: can't set Statistic Area config\r\n");
+      return;
+    }
+  }
+
   /* Apply configuration (for an output result available 2 VSYNC later) */
   for (i = DCMIPP_STATEXT_MODULE1; i <= DCMIPP_STATEXT_MODULE3; i++)
   {
@@ -1833,6 +1955,9 @@ void ISP_SVC_Stats_Gather(ISP_HandleTypeDef *hIsp)
     ISP_SVC_StatEngine.last.down = ongoing->down;
     ISP_SVC_StatEngine.last.downFrameIdEnd = frameId;
     ISP_SVC_StatEngine.last.downFrameIdStart = ongoing->downFrameIdStart;
+    ISP_SVC_StatEngine.last.nbROI = IsMeteringActive() ? metering->nbROI : 0;
+    ISP_SVC_StatEngine.last.weightROI = metering->weightROI;
+    memcpy(ISP_SVC_StatEngine.last.roi, ISP_SVC_StatEngine.roi, sizeof(ISP_SVC_StatEngine.roi));
 
     memset(&ongoing->down, 0, sizeof(ongoing->down));
     ongoing->downFrameIdStart = 0;
@@ -1851,6 +1976,8 @@ void ISP_SVC_Stats_Gather(ISP_HandleTypeDef *hIsp)
   /* Save the two last processed stages and go to next stage */
   stagePrevious2 = stagePrevious1;
   stagePrevious1 = ISP_SVC_StatEngine.stage;
+  roiPrevious2 = roiPrevious1;
+  roiPrevious1 = roiCurrent;
   ISP_SVC_StatEngine.stage = GetNextStatStage(ISP_SVC_StatEngine.stage);
 }
 
@@ -1984,3 +2111,82 @@ ISP_StatusTypeDef ISP_SVC_Stats_GetNext(ISP_HandleTypeDef *hIsp, ISP_stat_ready_
 
   return ISP_OK;
 }
+
+/**
+  * @brief  ISP_SVC_Stats_SetMetering
+  *         Set the metering regions measured in turn, one per down statistics cycle, in addition to
+  *         the stat area. Can be called while the statistics are gathered.
+  * @param  hIsp: ISP device handle
+  * @param  pMetering: pointer to the metering regions (nbROI = 0 to meter the stat area only)
+  * @retval ISP status
+  */
+ISP_StatusTypeDef ISP_SVC_Stats_SetMetering(ISP_HandleTypeDef *hIsp, ISP_MeteringTypeDef *pMetering)
+{
+  ISP_StatAreaTypeDef *pROI;
+  uint32_t i, next;
+
+  if ((hIsp == NULL) || (pMetering == NULL) || (pMetering->nbROI > ISP_METERING_ROI_MAX) ||
+      (pMetering->weightROI > 100))
+  {
+    return ISP_ERR_STATAREA_EINVAL;
+  }
+
+  for (i = 0; i < pMetering->nbROI; i++)
+  {
+    pROI = &pMetering->ROI[i];
+    if ((pROI->XSize < ISP_STATWINDOW_MIN) || (pROI->YSize < ISP_STATWINDOW_MIN) ||
+        (pROI->X0 + pROI->XSize > ISP_STATWINDOW_MAX) || (pROI->Y0 + pROI->YSize > ISP_STATWINDOW_MAX))
+    {
+      return ISP_ERR_STATAREA_EINVAL;
+    }
+  }
+
+  /* Fill the inactive regions and hand them over to ISP_SVC_Stats_Gather(). The pending update is
+   * cancelled first, so that the statistics interrupt never takes a partially written set.
+   */
+  ISP_SVC_StatEngine.meteringUpdate = 0;
+  __COMPILER_BARRIER();
+  next = 1 - ISP_SVC_StatEngine.meteringActive;
+  ISP_SVC_StatEngine.metering[next] = *pMetering;
+  __COMPILER_BARRIER();
+  ISP_SVC_StatEngine.meteringUpdate = next + 1;
+
+  return ISP_OK;
+}
+
+/**
+  * @brief  ISP_SVC_Stats_GetMeteredLuminance
+  *         Get the luminance to be controlled by the AEC: the down average luminance, weighted with
+  *         the average luminance of the metering regions if any. A region measured during an earlier
+  *         cycle is scaled by the down luminance change since its measure.
+  * @param  pStats: pointer to the statistics
+  * @retval Metered luminance
+  */
+uint8_t ISP_SVC_Stats_GetMeteredLuminance(ISP_SVC_StatStateTypeDef *pStats)
+{
+  ISP_SVC_RoiStatTypeDef *roi;
+  uint32_t i, L, roiL = 0, nbMeasured = 0;
+  uint32_t globalL = pStats->down.averageL;
+
+  for (i = 0; (i < pStats->nbROI) && (i < ISP_METERING_ROI_MAX); i++)
+  {
+    roi = &pStats->roi[i];
+    if (roi->frameId == 0)
+    {
+      continue;
+    }
+
+    L = (roi->globalL != 0) ? (roi->averageL * globalL + roi->globalL / 2) / roi->globalL : roi->averageL;
+    roiL += (L > 255) ? 255 : L;
+    nbMeasured++;
+  }
+
+  if (nbMeasured == 0)
+  {
+    return (uint8_t) globalL;
+  }
+
+  roiL = (roiL + nbMeasured / 2) / nbMeasured;
+
+  return (uint8_t) ((roiL * pStats->weightROI + globalL * (100 - pStats->weightROI) + 50) / 100);
+}
@@ -0,0 +1,153 @@
+/**
+ ******************************************************************************
+ * @file    isp_threadx.c
+ * @author  AIS Application Team
+ * @brief   ISP background process ThreadX service
+ *          The DCMIPP callbacks (ISP_GatherStatistics, ISP_IncMainFrameId)
+ *          post events to a dedicated thread which runs ISP_BackgroundProcess
+ *          only when new statistics or frames are available, instead of
+ *          polling it from the main loop.
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+#ifdef ISP_MW_THREADX_SUPPORT
+
+/* Includes ------------------------------------------------------------------*/
+#include "isp_api.h"
+#include "isp_threadx.h"
+
+/* Private types -------------------------------------------------------------*/
+/* Private constants ---------------------------------------------------------*/
+#define ISP_THREADX_EVENTS (ISP_EVENT_FRAME | ISP_EVENT_STATS)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  ISP_ThreadX_EventCb
+  *         ISP event callback: wake up the service thread
+  * @param  pContext: ISP ThreadX service handle
+  * @param  events: ISP_EVENT_xxx combination
+  * @retval None
+  */
+static void ISP_ThreadX_EventCb(void *pContext, uint32_t events)
+{
+  ISP_ThreadX_ServiceTypeDef *hService = (ISP_ThreadX_ServiceTypeDef *) pContext;
+
+  (void) tx_event_flags_set(&hService->events, (ULONG) events, TX_OR);
+}
+
+/**
+  * @brief  ISP_ThreadX_Entry
+  *         Service thread: run the ISP background process each time new data is available
+  * @param  arg: unused (the service handle is retrieved from the current thread)
+  * @retval None
+  */
+static VOID ISP_ThreadX_Entry(ULONG arg)
+{
+  ISP_ThreadX_ServiceTypeDef *hService = (ISP_ThreadX_ServiceTypeDef *) tx_thread_identify();
+  ISP_StatusTypeDef ret;
+  ULONG actual;
+  UINT status;
+
+  (void) arg;
+
+  while (1)
+  {
+#ifdef ISP_MW_TUNING_TOOL_SUPPORT
+    /* Tool commands are not notified: check them periodically when the sensor stream is idle */
+    status = tx_event_flags_get(&hService->events, ISP_THREADX_EVENTS, TX_OR_CLEAR, &actual, ISP_THREADX_TOOL_POLL_TICKS);
+    if ((status != TX_SUCCESS) && (status != TX_NO_EVENTS))
+#else
+    status = tx_event_flags_get(&hService->events, ISP_THREADX_EVENTS, TX_OR_CLEAR, &actual, TX_WAIT_FOREVER);
+    if (status != TX_SUCCESS)
+#endif
+    {
+      /* Service stopped (event group deleted or wait aborted) */
+      break;
+    }
+
+    ret = ISP_BackgroundProcess(hService->hIsp);
+    if (ret != ISP_OK)
+    {
+      hService->lastStatus = ret;
+    }
+    hService->processCount++;
+  }
+}
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  ISP_ThreadX_Start
+  *         Create the thread running the background process of an ISP device and register it
+  *         as the ISP event callback. Several ISP devices can each have their own service.
+  * @param  hService: ISP ThreadX service handle
+  * @param  hIsp: ISP device handle (ISP_Init() already done)
+  * @param  pStack: Pointer to the thread stack
+  * @param  StackSize: Size of the thread stack in bytes
+  * @param  Priority: ThreadX priority of the thread
+  * @retval Operation status
+  */
+ISP_StatusTypeDef ISP_ThreadX_Start(ISP_ThreadX_ServiceTypeDef *hService, ISP_HandleTypeDef *hIsp,
+                                    void *pStack, uint32_t StackSize, uint32_t Priority)
+{
+  if ((hService == NULL) || (hIsp == NULL) || (pStack == NULL))
+  {
+    return ISP_ERR_EINVAL;
+  }
+
+  memset(hService, 0, sizeof(*hService));
+  hService->hIsp = hIsp;
+  hService->lastStatus = ISP_OK;
+
+  if (tx_event_flags_create(&hService->events, "isp_events") != TX_SUCCESS)
+  {
+    return ISP_ERR_EINVAL;
+  }
+
+  if (tx_thread_create(&hService->thread, "isp_background", ISP_ThreadX_Entry, 0, pStack, (ULONG) StackSize,
+                       (UINT) Priority, (UINT) Priority, TX_NO_TIME_SLICE, TX_AUTO_START) != TX_SUCCESS)
+  {
+    (void) tx_event_flags_delete(&hService->events);
+    return ISP_ERR_EINVAL;
+  }
+
+  /* Frames may already be running: process once to catch up, then on events only */
+  (void) tx_event_flags_set(&hService->events, ISP_THREADX_EVENTS, TX_OR);
+
+  return ISP_SetEventCB(hIsp, ISP_ThreadX_EventCb, hService);
+}
+
+/**
+  * @brief  ISP_ThreadX_Stop
+  *         Unregister the ISP event callback and delete the service thread
+  * @param  hService: ISP ThreadX service handle
+  * @retval Operation status
+  */
+ISP_StatusTypeDef ISP_ThreadX_Stop(ISP_ThreadX_ServiceTypeDef *hService)
+{
+  if (hService == NULL)
+  {
+    return ISP_ERR_EINVAL;
+  }
+
+  (void) ISP_SetEventCB(hService->hIsp, NULL, NULL);
+
+  (void) tx_thread_terminate(&hService->thread);
+  (void) tx_thread_delete(&hService->thread);
+  (void) tx_event_flags_delete(&hService->events);
+
+  return ISP_OK;
+}
+
+#endif /* ISP_MW_THREADX_SUPPORT */
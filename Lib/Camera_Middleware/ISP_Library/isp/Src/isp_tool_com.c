@@ -22,6 +22,9 @@
 #include "isp_tool_com.h"
 #include "usbd_cdc_if.h"
 #include "usb_device.h"
+#ifdef ISP_MW_TOOL_FRAMING_SUPPORT
+#include "isp_tool_frame.h"
+#endif
 
 /* Private types -------------------------------------------------------------*/
 typedef struct {
@@ -29,13 +32,73 @@ typedef struct {
   uint32_t payload_size;
 }
 ISP_ToolCom_packet_t;
+
+#ifdef ISP_MW_TOOL_FRAMING_SUPPORT
 /* Private constants ---------------------------------------------------------*/
+/* Number of frames queued for transmission: one on the link while the next one is encoded */
+#ifndef ISP_TOOL_COM_TX_SLOTS
+#define ISP_TOOL_COM_TX_SLOTS     (2U)
+#endif
+/* Payload size of a frame: larger payloads are split */
+#ifndef ISP_TOOL_COM_TX_CHUNK
+#define ISP_TOOL_COM_TX_CHUNK     (16384U)
+#endif
+
+typedef struct {
+  uint8_t data[ISP_TOOL_FRAME_HEADER_SIZE + ISP_TOOL_COM_TX_CHUNK] __attribute__ ((aligned (32)));
+  uint32_t size;
+} ISP_ToolCom_TxSlot_t;
+
 /* Private macro -------------------------------------------------------------*/
+/* The transmission queue is shared with the transmit complete interrupt. On Linux the send is synchronous. */
+#if defined(LINUX)
+#define TOOLCOM_ENTER_CRITICAL()  do { } while (0)
+#define TOOLCOM_EXIT_CRITICAL()   do { } while (0)
+#else
+#define TOOLCOM_ENTER_CRITICAL()  uint32_t primask = __get_PRIMASK(); __disable_irq()
+#define TOOLCOM_EXIT_CRITICAL()   __set_PRIMASK(primask)
+#endif
+
+/* Private variables ---------------------------------------------------------*/
+static ISP_ToolCom_TxSlot_t ToolCom_TxSlot[ISP_TOOL_COM_TX_SLOTS];
+static volatile uint32_t ToolCom_TxHead;  /* Frames sent */
+static volatile uint32_t ToolCom_TxTail;  /* Frames queued */
+static volatile uint8_t ToolCom_TxBusy;
+static uint16_t ToolCom_TxSeq;
+#endif /* ISP_MW_TOOL_FRAMING_SUPPORT */
+
 /* Private function prototypes -----------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 ISP_ToolCom_packet_t received_packet;
 
 /* Private functions ---------------------------------------------------------*/
+#ifdef ISP_MW_TOOL_FRAMING_SUPPORT
+/* Start sending the next queued frame. Called with the transmit complete interrupt masked */
+static void ISP_ToolCom_StartTx(void)
+{
+  ISP_ToolCom_TxSlot_t *slot;
+
+  while (!ToolCom_TxBusy && (ToolCom_TxHead != ToolCom_TxTail))
+  {
+    slot = &ToolCom_TxSlot[ToolCom_TxHead % ISP_TOOL_COM_TX_SLOTS];
+    ToolCom_TxBusy = 1;
+#if defined(LINUX)
+    USB_CDC_Send_Wrapper_Function(slot->data, slot->size);
+    /* Sent on return */
+    ToolCom_TxHead++;
+    ToolCom_TxBusy = 0;
+#else
+    if (USB_CDC_Send_Wrapper_Function(slot->data, slot->size) != 0)
+    {
+      /* Link down: drop the frame rather than waiting for a completion which won't come */
+      ToolCom_TxHead++;
+      ToolCom_TxBusy = 0;
+    }
+#endif
+  }
+}
+#endif /* ISP_MW_TOOL_FRAMING_SUPPORT */
+
 /**
   * @brief  ISP_ToolCom_Init
   *         Initialize the communication link with the remote tool
@@ -119,4 +182,83 @@ void ISP_ToolCom_PrepareNextCommand()
   received_packet.payload_size = 0;
 }
 
+#ifdef ISP_MW_TOOL_FRAMING_SUPPORT
+/**
+  * @brief  ISP_ToolCom_SendFrame
+  *         Queue a payload for asynchronous transmission in binary frames (see isp_tool_frame.h), splitting
+  *         it in several frames if larger than ISP_TOOL_COM_TX_CHUNK. The payload is copied (and encoded)
+  *         into the transmission slots, so the buffer can be reused on return. Waits for a free slot if all
+  *         of them are on the link.
+  * @param  type: Frame type (ISP_ToolFrame_TypeTypeDef)
+  * @param  flags: ISP_TOOL_FRAME_FLAG_DELTA_RLE and ISP_TOOL_FRAME_STRIDE() to encode the payload, or 0
+  * @param  buffer: Pointer to buffer payload
+  * @param  buffer_size: Size of buffer payload
+  * @retval None
+  */
+void ISP_ToolCom_SendFrame(uint8_t type, uint8_t flags, uint8_t *buffer, uint32_t buffer_size)
+{
+  ISP_ToolFrame_HeaderTypeDef header;
+  ISP_ToolCom_TxSlot_t *slot;
+  uint32_t remaining = buffer_size;
+
+  header.type = type;
+  header.flags = flags | ISP_TOOL_FRAME_FLAG_FIRST;
+
+  do
+  {
+    header.rawSize = (remaining > ISP_TOOL_COM_TX_CHUNK) ? ISP_TOOL_COM_TX_CHUNK : remaining;
+    header.seq = ToolCom_TxSeq++;
+    if (header.rawSize == remaining)
+    {
+      header.flags |= ISP_TOOL_FRAME_FLAG_LAST;
+    }
+
+    /* Wait for a free slot */
+    while (ToolCom_TxTail - ToolCom_TxHead >= ISP_TOOL_COM_TX_SLOTS);
+
+    /* Encode while the previous frame is on the link */
+    slot = &ToolCom_TxSlot[ToolCom_TxTail % ISP_TOOL_COM_TX_SLOTS];
+    slot->size = ISP_ToolFrame_Encode(slot->data, sizeof(slot->data), &header, buffer);
+
+    {
+      TOOLCOM_ENTER_CRITICAL();
+      ToolCom_TxTail++;
+      ISP_ToolCom_StartTx();
+      TOOLCOM_EXIT_CRITICAL();
+    }
+
+    buffer += header.rawSize;
+    remaining -= header.rawSize;
+    header.flags &= ~ISP_TOOL_FRAME_FLAG_FIRST;
+  } while (remaining > 0);
+}
+
+/**
+  * @brief  ISP_ToolCom_TransmitCpltCb
+  *         To be called by the link driver (interrupt context) when a transmission is complete
+  * @param  None
+  * @retval None
+  */
+void ISP_ToolCom_TransmitCpltCb(void)
+{
+  if (ToolCom_TxBusy)
+  {
+    ToolCom_TxHead++;
+    ToolCom_TxBusy = 0;
+    ISP_ToolCom_StartTx();
+  }
+}
+
+/**
+  * @brief  ISP_ToolCom_WaitTxIdle
+  *         Wait for all the queued frames to be sent
+  * @param  None
+  * @retval None
+  */
+void ISP_ToolCom_WaitTxIdle(void)
+{
+  while (ToolCom_TxHead != ToolCom_TxTail);
+}
+#endif /* ISP_MW_TOOL_FRAMING_SUPPORT */
+
 #endif /* ISP_MW_TUNING_TOOL_SUPPORT */
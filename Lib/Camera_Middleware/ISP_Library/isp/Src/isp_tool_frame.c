@@ -0,0 +1,293 @@
+/**
+  ******************************************************************************
+  * @file    isp_tool_frame.c
+  * @author  AIS Application Team
+  * @brief   Binary framing of the IQ tuning tool transport: length prefixed
+  *          frames with an optional delta + run length encoding of the payload
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2023 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "isp_tool_frame.h"
+
+/* Private types -------------------------------------------------------------*/
+/* Private constants ---------------------------------------------------------*/
+/* Run length encoding: a control byte followed by
+ *  - c < 0x80: a literal of (c + 1) bytes
+ *  - c >= 0x80: one byte repeated ((c & 0x7F) + 3) times
+ */
+#define RLE_LITERAL_MAX     (128U)
+#define RLE_RUN_MIN         (3U)
+#define RLE_RUN_MAX         (RLE_RUN_MIN + 0x7FU)
+
+/* Private macro -------------------------------------------------------------*/
+#define GET_STRIDE(flags)   ((((flags) & ISP_TOOL_FRAME_STRIDE_Msk) >> ISP_TOOL_FRAME_STRIDE_Pos) ? \
+                             (((flags) & ISP_TOOL_FRAME_STRIDE_Msk) >> ISP_TOOL_FRAME_STRIDE_Pos) : 1U)
+
+/* Private function prototypes -----------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private functions ---------------------------------------------------------*/
+static void Put16(uint8_t *p, uint16_t v)
+{
+  p[0] = (uint8_t) v;
+  p[1] = (uint8_t) (v >> 8);
+}
+
+static void Put32(uint8_t *p, uint32_t v)
+{
+  Put16(p, (uint16_t) v);
+  Put16(p + 2, (uint16_t) (v >> 16));
+}
+
+static uint16_t Get16(const uint8_t *p)
+{
+  return (uint16_t) (p[0] | (p[1] << 8));
+}
+
+static uint32_t Get32(const uint8_t *p)
+{
+  return Get16(p) | ((uint32_t) Get16(p + 2) << 16);
+}
+
+/* Fletcher-16 of the header, its check field excluded */
+static uint16_t HeaderCheck(const uint8_t *p)
+{
+  uint32_t i, s1 = 0, s2 = 0;
+
+  for (i = 0; i < ISP_TOOL_FRAME_HEADER_SIZE; i++)
+  {
+    if ((i == 6) || (i == 7))
+    {
+      continue;
+    }
+    s1 = (s1 + p[i]) % 255;
+    s2 = (s2 + s1) % 255;
+  }
+
+  return (uint16_t) ((s2 << 8) | s1);
+}
+
+static uint8_t Delta(const uint8_t *pIn, uint32_t i, uint32_t stride)
+{
+  return (i >= stride) ? (uint8_t) (pIn[i] - pIn[i - stride]) : pIn[i];
+}
+
+/* Delta + run length encode pIn. Returns the encoded size, or 0 if it does not fit in outMax bytes */
+static uint32_t DeltaRle_Encode(uint8_t *pOut, uint32_t outMax, const uint8_t *pIn, uint32_t inSize, uint32_t stride)
+{
+  uint32_t i = 0, o = 0, litStart = 0, n, j, run;
+  uint8_t d;
+
+  while (i <= inSize)
+  {
+    /* Measure the run starting at i */
+    run = 0;
+    if (i < inSize)
+    {
+      d = Delta(pIn, i, stride);
+      run = 1;
+      while ((i + run < inSize) && (run < RLE_RUN_MAX) && (Delta(pIn, i + run, stride) == d))
+      {
+        run++;
+      }
+    }
+
+    /* Flush the pending literal before a run, at the end, or when full */
+    while ((i > litStart) && ((run >= RLE_RUN_MIN) || (i == inSize) || (i - litStart >= RLE_LITERAL_MAX)))
+    {
+      n = i - litStart;
+      n = (n > RLE_LITERAL_MAX) ? RLE_LITERAL_MAX : n;
+      if (o + 1 + n > outMax)
+      {
+        return 0;
+      }
+      pOut[o++] = (uint8_t) (n - 1);
+      for (j = 0; j < n; j++)
+      {
+        pOut[o++] = Delta(pIn, litStart + j, stride);
+      }
+      litStart += n;
+    }
+
+    if (i == inSize)
+    {
+      break;
+    }
+
+    if (run >= RLE_RUN_MIN)
+    {
+      if (o + 2 > outMax)
+      {
+        return 0;
+      }
+      pOut[o++] = (uint8_t) (0x80U | (run - RLE_RUN_MIN));
+      pOut[o++] = d;
+      litStart = i + run;
+    }
+    i += run;
+  }
+
+  return o;
+}
+
+/* Inverse of DeltaRle_Encode(). Returns 0 if the encoded data is corrupted */
+static uint32_t DeltaRle_Decode(uint8_t *pOut, uint32_t outSize, const uint8_t *pIn, uint32_t inSize, uint32_t stride)
+{
+  uint32_t i = 0, o = 0, n;
+  uint8_t c;
+
+  while (o < outSize)
+  {
+    if (i >= inSize)
+    {
+      return 0;
+    }
+
+    c = pIn[i++];
+    if (c & 0x80U)
+    {
+      n = (c & 0x7FU) + RLE_RUN_MIN;
+      if ((i >= inSize) || (o + n > outSize))
+      {
+        return 0;
+      }
+      memset(&pOut[o], pIn[i++], n);
+    }
+    else
+    {
+      n = c + 1U;
+      if ((i + n > inSize) || (o + n > outSize))
+      {
+        return 0;
+      }
+      memcpy(&pOut[o], &pIn[i], n);
+      i += n;
+    }
+    o += n;
+  }
+
+  if (i != inSize)
+  {
+    return 0;
+  }
+
+  for (o = stride; o < outSize; o++)
+  {
+    pOut[o] += pOut[o - stride];
+  }
+
+  return outSize;
+}
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  ISP_ToolFrame_Encode
+  *         Build a frame: header then payload. With ISP_TOOL_FRAME_FLAG_DELTA_RLE, the payload is encoded
+  *         unless it does not get smaller, in which case it is sent as is and the flag is cleared.
+  * @param  pOut: Output buffer, at least ISP_TOOL_FRAME_HEADER_SIZE + pHeader->rawSize bytes
+  * @param  outSize: Size of the output buffer
+  * @param  pHeader: Frame type, flags, sequence number and payload size (rawSize). size is ignored.
+  * @param  pIn: Payload
+  * @retval Frame size, or 0 if the output buffer is too small
+  */
+uint32_t ISP_ToolFrame_Encode(uint8_t *pOut, uint32_t outSize, const ISP_ToolFrame_HeaderTypeDef *pHeader,
+                              const uint8_t *pIn)
+{
+  uint32_t size = 0;
+  uint8_t flags = pHeader->flags;
+
+  if (outSize < ISP_TOOL_FRAME_HEADER_SIZE + pHeader->rawSize)
+  {
+    return 0;
+  }
+
+  if (flags & ISP_TOOL_FRAME_FLAG_DELTA_RLE)
+  {
+    /* Keep the encoded payload only if smaller */
+    size = DeltaRle_Encode(pOut + ISP_TOOL_FRAME_HEADER_SIZE, pHeader->rawSize - 1, pIn, pHeader->rawSize,
+                           GET_STRIDE(flags));
+  }
+
+  if (size == 0)
+  {
+    flags &= ~ISP_TOOL_FRAME_FLAG_DELTA_RLE;
+    size = pHeader->rawSize;
+    memcpy(pOut + ISP_TOOL_FRAME_HEADER_SIZE, pIn, size);
+  }
+
+  pOut[0] = ISP_TOOL_FRAME_MAGIC0;
+  pOut[1] = ISP_TOOL_FRAME_MAGIC1;
+  pOut[2] = pHeader->type;
+  pOut[3] = flags;
+  Put16(&pOut[4], pHeader->seq);
+  Put32(&pOut[8], size);
+  Put32(&pOut[12], pHeader->rawSize);
+  Put16(&pOut[6], HeaderCheck(pOut));
+
+  return ISP_TOOL_FRAME_HEADER_SIZE + size;
+}
+
+/**
+  * @brief  ISP_ToolFrame_ParseHeader
+  *         Check and parse the ISP_TOOL_FRAME_HEADER_SIZE bytes of a frame header
+  * @param  pIn: Header bytes
+  * @param  pHeader: Parsed header
+  * @retval 0 if the header is valid, -1 otherwise (the receiver shall resynchronize on the next magic)
+  */
+int32_t ISP_ToolFrame_ParseHeader(const uint8_t *pIn, ISP_ToolFrame_HeaderTypeDef *pHeader)
+{
+  if ((pIn[0] != ISP_TOOL_FRAME_MAGIC0) || (pIn[1] != ISP_TOOL_FRAME_MAGIC1) || (Get16(&pIn[6]) != HeaderCheck(pIn)))
+  {
+    return -1;
+  }
+
+  pHeader->type = pIn[2];
+  pHeader->flags = pIn[3];
+  pHeader->seq = Get16(&pIn[4]);
+  pHeader->size = Get32(&pIn[8]);
+  pHeader->rawSize = Get32(&pIn[12]);
+
+  return 0;
+}
+
+/**
+  * @brief  ISP_ToolFrame_Decode
+  *         Decode the payload of a frame
+  * @param  pHeader: Frame header, as parsed by ISP_ToolFrame_ParseHeader()
+  * @param  pIn: Payload (pHeader->size bytes)
+  * @param  pOut: Decoded payload
+  * @param  outSize: Size of the pOut buffer
+  * @retval Decoded size (pHeader->rawSize), or 0 if the payload is corrupted or pOut too small
+  */
+uint32_t ISP_ToolFrame_Decode(const ISP_ToolFrame_HeaderTypeDef *pHeader, const uint8_t *pIn, uint8_t *pOut,
+                              uint32_t outSize)
+{
+  if (pHeader->rawSize > outSize)
+  {
+    return 0;
+  }
+
+  if (pHeader->flags & ISP_TOOL_FRAME_FLAG_DELTA_RLE)
+  {
+    return DeltaRle_Decode(pOut, pHeader->rawSize, pIn, pHeader->size, GET_STRIDE(pHeader->flags));
+  }
+
+  if (pHeader->size != pHeader->rawSize)
+  {
+    return 0;
+  }
+  memcpy(pOut, pIn, pHeader->size);
+
+  return pHeader->size;
+}
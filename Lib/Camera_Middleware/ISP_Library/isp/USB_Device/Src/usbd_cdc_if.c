@@ -219,6 +219,11 @@ static int8_t CDC_TransmitCplt(uint8_t *Buf, uint32_t *Len, uint8_t epnum)
   UNUSED(Len);
   UNUSED(epnum);
 
+#ifdef ISP_MW_TOOL_FRAMING_SUPPORT
+  /* Send the next queued frame */
+  ISP_ToolCom_TransmitCpltCb();
+#endif
+
   return result;
 }
 
@@ -0,0 +1,78 @@
+/**
+ ******************************************************************************
+ * @file    awb_cct_check.c
+ * @author  AIS Application Team
+ * @brief   Host check of the SimpleAWB_CCT estimation against the double
+ *          precision reference implementation (ALGO_AWB_CCT_DOUBLE_REF)
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+uint32_t ISP_Algo_CCT_Estimate(uint8_t r, uint8_t g, uint8_t b);
+uint32_t ISP_Algo_CCT_EstimateRef(uint8_t r, uint8_t g, uint8_t b);
+
+int main(void)
+{
+  uint32_t maxErr = 0, maxErr10K = 0, ref, est, err;
+  uint32_t maxR = 0, maxG = 0, maxB = 0;
+  uint32_t nbBoth = 0, nbRejected = 0, nbMismatch = 0;
+
+  /* Sweep the full 8-bit RGB cube */
+  for (uint32_t rgb = 0; rgb < (1U << 24); rgb++)
+  {
+    uint8_t r = (uint8_t) (rgb >> 16), g = (uint8_t) (rgb >> 8), b = (uint8_t) rgb;
+
+    ref = ISP_Algo_CCT_EstimateRef(r, g, b);
+    est = ISP_Algo_CCT_Estimate(r, g, b);
+
+    if ((ref == 0) || (est == 0))
+    {
+      /* Not estimated by at least one implementation (black or near-singular color) */
+      if ((ref == 0) && (est == 0))
+      {
+        nbRejected++;
+      }
+      else
+      {
+        nbMismatch++;
+      }
+      continue;
+    }
+
+    nbBoth++;
+    err = (uint32_t) abs((int32_t) est - (int32_t) ref);
+    if (err > maxErr)
+    {
+      maxErr = err;
+      maxR = r;
+      maxG = g;
+      maxB = b;
+    }
+    if ((ref <= 10000) && (err > maxErr10K))
+    {
+      maxErr10K = err;
+    }
+  }
+
+  printf("colors estimated by both        : %u\n", nbBoth);
+  printf("colors rejected by both         : %u\n", nbRejected);
+  printf("colors rejected by only one     : %u\n", nbMismatch);
+  printf("max error                       : %u K at (%u,%u,%u) ref=%u K\n", maxErr, maxR, maxG, maxB,
+         ISP_Algo_CCT_EstimateRef((uint8_t) maxR, (uint8_t) maxG, (uint8_t) maxB));
+  printf("max error for reference <= 10000K: %u K\n", maxErr10K);
+
+  return 0;
+}
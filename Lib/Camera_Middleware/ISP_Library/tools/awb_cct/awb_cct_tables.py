@@ -0,0 +1,30 @@
+#!/usr/bin/env python3
+# Generate the look-up tables of isp/Src/isp_algo_cct.c:
+#  - ISP_Algo_SimpleAWB_CCT_LinearSrgbLUT: sRGB decoding of c / 255 for c in [0, 255]
+#  - ISP_Algo_SimpleAWB_CCT_FixedCurve: corrected McCamy CCT sampled on n in [N_MIN, N_MAX]
+
+N_MIN = -1.0
+N_MAX = 1.0
+CURVE_SIZE = 256
+
+
+def linear_srgb(c):
+    return c / 12.92 if c <= 0.04045 else ((c + 0.055) / 1.055) ** 2.4
+
+
+def fixed_cct(n):
+    cct = 449 * n ** 3 + 3525 * n ** 2 + 6823.3 * n + 5520.33
+    return 0.0005517 * cct * cct - 4.597 * cct + 12208
+
+
+def print_table(values, fmt):
+    lines = []
+    for i in range(0, len(values), 8):
+        lines.append("  " + ", ".join(fmt % v for v in values[i:i + 8]))
+    print(",\n".join(lines))
+
+
+print("/* ISP_Algo_SimpleAWB_CCT_LinearSrgbLUT */")
+print_table([linear_srgb(i / 255.0) for i in range(256)], "%.8ef")
+print("/* ISP_Algo_SimpleAWB_CCT_FixedCurve */")
+print_table([fixed_cct(N_MIN + (N_MAX - N_MIN) * i / CURVE_SIZE) for i in range(CURVE_SIZE + 1)], "%.2ff")
@@ -0,0 +1,148 @@
+/**
+ ******************************************************************************
+ * @file    isp_threadx_test.c
+ * @author  AIS Application Team
+ * @brief   Host test of the ISP ThreadX service on the ThreadX Linux port.
+ *          Two ISP devices are fed by a simulated sensor thread posting
+ *          statistics and frame events; the test checks each service thread
+ *          processes all the frames of its own device and stays idle (no
+ *          polling) when no event is posted.
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "isp_api.h"
+#include "isp_threadx.h"
+
+#define TEST_NB_ISP       2
+#define TEST_NB_FRAMES    50
+#define TEST_IDLE_TICKS   30
+#define TEST_STACK_SIZE   4096
+
+static ISP_HandleTypeDef hIsp[TEST_NB_ISP];
+static ISP_ThreadX_ServiceTypeDef hService[TEST_NB_ISP];
+static uint32_t processedFrames[TEST_NB_ISP];
+static TX_THREAD sensorThread;
+static UCHAR serviceStack[TEST_NB_ISP][TEST_STACK_SIZE];
+static UCHAR sensorStack[TEST_STACK_SIZE];
+
+/* Minimal ISP core: frame counting and event notification as done by isp_core.c */
+ISP_StatusTypeDef ISP_SetEventCB(ISP_HandleTypeDef *pIsp, ISP_EventCBTypeDef EventCB, void *pContext)
+{
+  pIsp->eventContext = pContext;
+  pIsp->eventCB = EventCB;
+  return ISP_OK;
+}
+
+void ISP_GatherStatistics(ISP_HandleTypeDef *pIsp)
+{
+  if (pIsp->eventCB != NULL)
+  {
+    pIsp->eventCB(pIsp->eventContext, ISP_EVENT_STATS);
+  }
+}
+
+void ISP_IncMainFrameId(ISP_HandleTypeDef *pIsp)
+{
+  pIsp->MainPipe_FrameCount++;
+  if (pIsp->eventCB != NULL)
+  {
+    pIsp->eventCB(pIsp->eventContext, ISP_EVENT_FRAME);
+  }
+}
+
+ISP_StatusTypeDef ISP_BackgroundProcess(ISP_HandleTypeDef *pIsp)
+{
+  uint32_t id = (uint32_t) (pIsp - hIsp);
+
+  if (pIsp->MainPipe_FrameCount != pIsp->LastProcessedFrameId)
+  {
+    pIsp->LastProcessedFrameId = pIsp->MainPipe_FrameCount;
+    processedFrames[id] = pIsp->LastProcessedFrameId;
+  }
+
+  return ISP_OK;
+}
+
+static VOID sensor_entry(ULONG arg)
+{
+  uint32_t frame, i, count[TEST_NB_ISP];
+  int failed = 0;
+
+  (void) arg;
+
+  for (frame = 1; frame <= TEST_NB_FRAMES; frame++)
+  {
+    /* Device 0 runs at every tick, device 1 at every other tick */
+    for (i = 0; i < TEST_NB_ISP; i++)
+    {
+      if ((frame % (i + 1)) == 0)
+      {
+        ISP_GatherStatistics(&hIsp[i]);
+        ISP_IncMainFrameId(&hIsp[i]);
+      }
+    }
+    tx_thread_sleep(1);
+  }
+
+  /* Let the services catch up, then check they stay idle without events */
+  tx_thread_sleep(2);
+  for (i = 0; i < TEST_NB_ISP; i++)
+  {
+    count[i] = hService[i].processCount;
+  }
+  tx_thread_sleep(TEST_IDLE_TICKS);
+
+  for (i = 0; i < TEST_NB_ISP; i++)
+  {
+    printf("ISP %u: frames %u processed %u, background runs %u (idle runs %u)\n", i,
+           hIsp[i].MainPipe_FrameCount, processedFrames[i], hService[i].processCount,
+           hService[i].processCount - count[i]);
+    if ((processedFrames[i] != hIsp[i].MainPipe_FrameCount) ||
+        (hService[i].processCount - count[i] > TEST_IDLE_TICKS / ISP_THREADX_TOOL_POLL_TICKS) ||
+        (hService[i].lastStatus != ISP_OK))
+    {
+      failed = 1;
+    }
+    ISP_ThreadX_Stop(&hService[i]);
+  }
+
+  printf("%s\n", failed ? "FAILED" : "SUCCESS");
+  exit(failed);
+}
+
+void tx_application_define(void *first_unused_memory)
+{
+  uint32_t i;
+
+  (void) first_unused_memory;
+
+  for (i = 0; i < TEST_NB_ISP; i++)
+  {
+    if (ISP_ThreadX_Start(&hService[i], &hIsp[i], serviceStack[i], TEST_STACK_SIZE, 10) != ISP_OK)
+    {
+      printf("FAILED: service %u start\n", i);
+      exit(1);
+    }
+  }
+
+  tx_thread_create(&sensorThread, "sensor", sensor_entry, 0, sensorStack, TEST_STACK_SIZE, 5, 5,
+                   TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+int main(void)
+{
+  tx_kernel_enter();
+  return 0;
+}
@@ -0,0 +1,25 @@
+/**
+ ******************************************************************************
+ * @file    iqtune-linux-wrapper.h
+ * @author  AIS Application Team
+ * @brief   Host stand-in of the Linux wrapper for the ThreadX service test
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __IQTUNE_LINUX_WRAPPER_H
+#define __IQTUNE_LINUX_WRAPPER_H
+
+/* No HAL on host: the test only uses the ISP types and the ThreadX service */
+
+#endif /* __IQTUNE_LINUX_WRAPPER_H */
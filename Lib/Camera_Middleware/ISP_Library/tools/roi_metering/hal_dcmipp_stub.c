@@ -0,0 +1,63 @@
+/**
+ ******************************************************************************
+ * @file    hal_dcmipp_stub.c
+ * @author  AIS Application Team
+ * @brief   No-op DCMIPP HAL functions referenced by isp_services.c and not
+ *          used by the statistic engine
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* The HAL header is deliberately not included: every stub returns 0 (HAL_OK, reset state, disabled) */
+#define HAL_STUB(name) int name(void) { return 0; }
+
+HAL_STUB(HAL_DCMIPP_GetState)
+HAL_STUB(HAL_DCMIPP_PIPE_GetState)
+HAL_STUB(HAL_DCMIPP_PIPE_DisableGammaConversion)
+HAL_STUB(HAL_DCMIPP_PIPE_DisableISPBadPixelRemoval)
+HAL_STUB(HAL_DCMIPP_PIPE_DisableISPBlackLevelCalibration)
+HAL_STUB(HAL_DCMIPP_PIPE_DisableISPColorConversion)
+HAL_STUB(HAL_DCMIPP_PIPE_DisableISPCtrlContrast)
+HAL_STUB(HAL_DCMIPP_PIPE_DisableISPExposure)
+HAL_STUB(HAL_DCMIPP_PIPE_DisableISPRawBayer2RGB)
+HAL_STUB(HAL_DCMIPP_PIPE_DisableISPRemovalStatistic)
+HAL_STUB(HAL_DCMIPP_PIPE_EnableGammaConversion)
+HAL_STUB(HAL_DCMIPP_PIPE_EnableISPAreaStatisticExtraction)
+HAL_STUB(HAL_DCMIPP_PIPE_EnableISPBadPixelRemoval)
+HAL_STUB(HAL_DCMIPP_PIPE_EnableISPBlackLevelCalibration)
+HAL_STUB(HAL_DCMIPP_PIPE_EnableISPColorConversion)
+HAL_STUB(HAL_DCMIPP_PIPE_EnableISPCtrlContrast)
+HAL_STUB(HAL_DCMIPP_PIPE_EnableISPDecimation)
+HAL_STUB(HAL_DCMIPP_PIPE_EnableISPExposure)
+HAL_STUB(HAL_DCMIPP_PIPE_EnableISPRawBayer2RGB)
+HAL_STUB(HAL_DCMIPP_PIPE_EnableISPRemovalStatistic)
+HAL_STUB(HAL_DCMIPP_PIPE_EnableISPStatisticExtraction)
+HAL_STUB(HAL_DCMIPP_PIPE_GetISPAreaStatisticExtractionConfig)
+HAL_STUB(HAL_DCMIPP_PIPE_GetISPBadPixelRemovalConfig)
+HAL_STUB(HAL_DCMIPP_PIPE_GetISPBlackLevelCalibrationConfig)
+HAL_STUB(HAL_DCMIPP_PIPE_GetISPColorConversionConfig)
+HAL_STUB(HAL_DCMIPP_PIPE_GetISPExposureConfig)
+HAL_STUB(HAL_DCMIPP_PIPE_GetISPRemovedBadPixelCounter)
+HAL_STUB(HAL_DCMIPP_PIPE_IsEnabledGammaConversion)
+HAL_STUB(HAL_DCMIPP_PIPE_IsEnabledISPAreaStatisticExtraction)
+HAL_STUB(HAL_DCMIPP_PIPE_IsEnabledISPBadPixelRemoval)
+HAL_STUB(HAL_DCMIPP_PIPE_IsEnabledISPBlackLevelCalibration)
+HAL_STUB(HAL_DCMIPP_PIPE_IsEnabledISPColorConversion)
+HAL_STUB(HAL_DCMIPP_PIPE_IsEnabledISPExposure)
+HAL_STUB(HAL_DCMIPP_PIPE_SetISPBadPixelRemovalConfig)
+HAL_STUB(HAL_DCMIPP_PIPE_SetISPBlackLevelCalibrationConfig)
+HAL_STUB(HAL_DCMIPP_PIPE_SetISPColorConversionConfig)
+HAL_STUB(HAL_DCMIPP_PIPE_SetISPCtrlContrastConfig)
+HAL_STUB(HAL_DCMIPP_PIPE_SetISPDecimationConfig)
+HAL_STUB(HAL_DCMIPP_PIPE_SetISPExposureConfig)
+HAL_STUB(HAL_DCMIPP_PIPE_SetISPRawBayer2RGBConfig)
+HAL_STUB(HAL_DCMIPP_PIPE_SetISPRemovalStatisticConfig)
@@ -0,0 +1,290 @@
+/**
+ ******************************************************************************
+ * @file    roi_metering_sim.c
+ * @author  AIS Application Team
+ * @brief   Host simulation of the AEC metering regions: the statistic engine
+ *          of isp_services.c measures a synthetic back-lit scene through a
+ *          DCMIPP model, and a proportional exposure loop runs on the metered
+ *          luminance
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "isp_core.h"
+#include "isp_services.h"
+
+#define SIM_WIDTH           2592U
+#define SIM_HEIGHT          1944U
+#define SIM_NB_OBJECTS      2U
+#define SIM_TARGET_L        56U   /* Luminance targeted by the exposure loop */
+#define SIM_TOLERANCE_L     3U
+#define SIM_SENSOR_LATENCY  2U    /* Frames before a new exposure applies */
+#define SIM_NB_FRAMES       400U
+
+/* Scene: bright background (window, sky) with darker objects */
+typedef struct
+{
+  ISP_StatAreaTypeDef rect;
+  double reflectance;
+} SIM_Object;
+
+static const double SIM_Background = 0.9;
+static const SIM_Object SIM_Objects[SIM_NB_OBJECTS] = {
+  { { 1000, 700, 400, 500 }, 0.15 },
+  { { 1900, 1200, 300, 400 }, 0.30 },
+};
+
+/* DCMIPP model: configuration written by the ISP, latched at VSYNC, and counters of the last frame */
+typedef struct
+{
+  DCMIPP_StatisticExtractionConfTypeDef conf[3];
+  DCMIPP_StatisticExtractionAreaConfTypeDef area;
+} SIM_StatConfig;
+
+static SIM_StatConfig SIM_Written, SIM_Latched;
+static uint32_t SIM_Counter[3];
+
+/* Exposure loop state */
+static double SIM_Exposure, SIM_ExposurePending[SIM_SENSOR_LATENCY + 1];
+static ISP_HandleTypeDef SIM_hIsp;
+static ISP_SVC_StatStateTypeDef SIM_Stats;
+static uint32_t SIM_NbAecRuns;
+
+HAL_StatusTypeDef HAL_DCMIPP_PIPE_SetISPStatisticExtractionConfig(DCMIPP_HandleTypeDef *hdcmipp, uint32_t Pipe,
+                                                                  uint8_t ModuleID, const
+                                                                  DCMIPP_StatisticExtractionConfTypeDef
+                                                                  *pStatisticExtractionConfig)
+{
+  (void) hdcmipp;
+  (void) Pipe;
+  SIM_Written.conf[ModuleID - DCMIPP_STATEXT_MODULE1] = *pStatisticExtractionConfig;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DCMIPP_PIPE_SetISPAreaStatisticExtractionConfig(DCMIPP_HandleTypeDef *hdcmipp, uint32_t Pipe,
+                                                                      const DCMIPP_StatisticExtractionAreaConfTypeDef
+                                                                      *pStatisticExtractionAreaConfig)
+{
+  (void) hdcmipp;
+  (void) Pipe;
+  SIM_Written.area = *pStatisticExtractionAreaConfig;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DCMIPP_PIPE_GetISPAccumulatedStatisticsCounter(const DCMIPP_HandleTypeDef *hdcmipp, uint32_t Pipe,
+                                                                     uint8_t ModuleID, uint32_t *pCounter)
+{
+  (void) hdcmipp;
+  (void) Pipe;
+  *pCounter = SIM_Counter[ModuleID - DCMIPP_STATEXT_MODULE1];
+  return HAL_OK;
+}
+
+static double SIM_PixelValue(double reflectance, double exposure)
+{
+  double v = reflectance * exposure;
+  return (v > 255.0) ? 255.0 : v;
+}
+
+static uint32_t SIM_Overlap(uint32_t a0, uint32_t aSize, uint32_t b0, uint32_t bSize)
+{
+  uint32_t start = (a0 > b0) ? a0 : b0;
+  uint32_t end = ((a0 + aSize) < (b0 + bSize)) ? (a0 + aSize) : (b0 + bSize);
+  return (end > start) ? end - start : 0;
+}
+
+/* Sum of the pixel values of the scene inside the latched stat area */
+static double SIM_SumArea(const DCMIPP_StatisticExtractionAreaConfTypeDef *area, double exposure)
+{
+  double sum, objectPixels = 0;
+  uint32_t i, n;
+
+  sum = 0;
+  for (i = 0; i < SIM_NB_OBJECTS; i++)
+  {
+    n = SIM_Overlap(area->HStart, area->HSize, SIM_Objects[i].rect.X0, SIM_Objects[i].rect.XSize) *
+        SIM_Overlap(area->VStart, area->VSize, SIM_Objects[i].rect.Y0, SIM_Objects[i].rect.YSize);
+    sum += n * SIM_PixelValue(SIM_Objects[i].reflectance, exposure);
+    objectPixels += n;
+  }
+
+  return sum + ((double) area->HSize * area->VSize - objectPixels) * SIM_PixelValue(SIM_Background, exposure);
+}
+
+/* Statistics of a frame, measured with the latched configuration. Grey scene: R = G = B */
+static void SIM_MeasureFrame(double exposure)
+{
+  double sum = SIM_SumArea(&SIM_Latched.area, exposure), share;
+  uint32_t i, src;
+
+  for (i = 0; i < 3; i++)
+  {
+    if (SIM_Latched.conf[i].Mode != DCMIPP_STAT_EXT_MODE_AVERAGE)
+    {
+      /* Bins are not used by the AEC */
+      SIM_Counter[i] = 0;
+      continue;
+    }
+
+    /* Before demosaicing, each component is one pixel out of 4 (red, blue) or 2 (green) of the Bayer pattern */
+    src = SIM_Latched.conf[i].Source;
+    if ((src == DCMIPP_STAT_EXT_SOURCE_PRE_BLKLVL_R) || (src == DCMIPP_STAT_EXT_SOURCE_PRE_BLKLVL_B))
+    {
+      share = 0.25;
+    }
+    else if (src == DCMIPP_STAT_EXT_SOURCE_PRE_BLKLVL_G)
+    {
+      share = 0.5;
+    }
+    else
+    {
+      share = 1;
+    }
+
+    /* Counters hold the accumulation divided by 256 */
+    SIM_Counter[i] = (uint32_t) (sum * share / 256);
+  }
+}
+
+static ISP_StatusTypeDef SIM_AecCallback(ISP_AlgoTypeDef *pAlgo)
+{
+  double metered, ratio;
+
+  (void) pAlgo;
+
+  metered = ISP_SVC_Stats_GetMeteredLuminance(&SIM_Stats);
+  ratio = (metered > 0) ? (double) SIM_TARGET_L / metered : 2.0;
+  ratio = (ratio > 2.0) ? 2.0 : ((ratio < 0.5) ? 0.5 : ratio);
+
+  /* Program the sensor: the new exposure applies SIM_SENSOR_LATENCY frames later */
+  SIM_ExposurePending[SIM_SENSOR_LATENCY] = SIM_ExposurePending[SIM_SENSOR_LATENCY] * ratio;
+  SIM_NbAecRuns++;
+
+  /* Next statistics once the new exposure is measured */
+  return ISP_SVC_Stats_GetNext(&SIM_hIsp, SIM_AecCallback, NULL, &SIM_Stats, ISP_STAT_LOC_DOWN, ISP_STAT_TYPE_AVG,
+                               SIM_SENSOR_LATENCY + 1);
+}
+
+/* Run the loop and return the object luminance (averaged over the metered objects) once converged */
+static double SIM_Run(const char *name, uint32_t nbROI, uint32_t weightROI, uint32_t *pCycle)
+{
+  ISP_MeteringTypeDef metering = { 0 };
+  ISP_SVC_StatStateTypeDef last;
+  uint32_t i, frame, lastEnd = 0, cycle = 0;
+  double objectL = 0;
+
+  metering.nbROI = nbROI;
+  metering.weightROI = weightROI;
+  for (i = 0; i < nbROI; i++)
+  {
+    metering.ROI[i] = SIM_Objects[i].rect;
+  }
+  if (ISP_SVC_Stats_SetMetering(&SIM_hIsp, &metering) != ISP_OK)
+  {
+    printf("%s: ISP_SVC_Stats_SetMetering failed\n", name);
+    exit(1);
+  }
+
+  SIM_Exposure = 100;
+  for (i = 0; i <= SIM_SENSOR_LATENCY; i++)
+  {
+    SIM_ExposurePending[i] = SIM_Exposure;
+  }
+  SIM_NbAecRuns = 0;
+
+  for (frame = 0; frame < SIM_NB_FRAMES; frame++)
+  {
+    /* Sensor exposure pipeline */
+    SIM_Exposure = SIM_ExposurePending[0];
+    memmove(&SIM_ExposurePending[0], &SIM_ExposurePending[1], SIM_SENSOR_LATENCY * sizeof(double));
+
+    /* VSYNC: counters of the ended frame, shadow registers load, then the ISP VSYNC handler */
+    SIM_MeasureFrame(SIM_Exposure);
+    SIM_Latched = SIM_Written;
+    ISP_SVC_Stats_Gather(&SIM_hIsp);
+
+    /* Frame end then background process */
+    ISP_SVC_Misc_IncMainFrameId(&SIM_hIsp);
+    ISP_SVC_Stats_ProcessCallbacks(&SIM_hIsp);
+
+    ISP_SVC_Stats_GetLatest(&SIM_hIsp, &last);
+    if (last.downFrameIdEnd != lastEnd)
+    {
+      cycle = last.downFrameIdEnd - lastEnd;
+      lastEnd = last.downFrameIdEnd;
+    }
+  }
+
+  for (i = 0; i < ((nbROI != 0) ? nbROI : 1); i++)
+  {
+    objectL += SIM_PixelValue(SIM_Objects[i].reflectance, SIM_Exposure);
+  }
+  objectL /= (nbROI != 0) ? nbROI : 1;
+
+  printf("%-22s exposure %7.1f  background L %5.1f  object L %5.1f  down cycle %lu frames  AEC runs %lu\n", name,
+         SIM_Exposure, SIM_PixelValue(SIM_Background, SIM_Exposure), objectL, (unsigned long) cycle,
+         (unsigned long) SIM_NbAecRuns);
+
+  *pCycle = cycle;
+  return objectL;
+}
+
+int main(void)
+{
+  uint32_t cycleOff, cycleOn, cycleTwo, cycleHalf;
+  double offL, oneL, twoL, halfL;
+  ISP_MeteringTypeDef invalid = { 0 };
+  int ok = 1;
+
+  memset(&SIM_hIsp, 0, sizeof(SIM_hIsp));
+  SIM_hIsp.statArea.X0 = 0;
+  SIM_hIsp.statArea.Y0 = 0;
+  SIM_hIsp.statArea.XSize = SIM_WIDTH;
+  SIM_hIsp.statArea.YSize = SIM_HEIGHT;
+  SIM_Written.area.HSize = SIM_WIDTH;
+  SIM_Written.area.VSize = SIM_HEIGHT;
+
+  ISP_SVC_Stats_GetNext(&SIM_hIsp, SIM_AecCallback, NULL, &SIM_Stats, ISP_STAT_LOC_DOWN, ISP_STAT_TYPE_AVG, 0);
+
+  offL = SIM_Run("no metering region", 0, 0, &cycleOff);
+  oneL = SIM_Run("1 region, weight 100", 1, 100, &cycleOn);
+  twoL = SIM_Run("2 regions, weight 100", 2, 100, &cycleTwo);
+  halfL = SIM_Run("1 region, weight 50", 1, 50, &cycleHalf);
+
+  /* Whole frame metering leaves the objects dark; region metering brings them to the target */
+  ok &= (offL < SIM_TARGET_L / 2);
+  ok &= (abs((int) (oneL + 0.5) - (int) SIM_TARGET_L) <= (int) SIM_TOLERANCE_L);
+  ok &= (abs((int) (twoL + 0.5) - (int) SIM_TARGET_L) <= (int) SIM_TOLERANCE_L);
+  ok &= (halfL > offL) && (halfL < oneL);
+
+  /* Metering regions add one stage to the down cycle, whatever their number */
+  ok &= (cycleOn == cycleOff + 1) && (cycleTwo == cycleOn) && (cycleHalf == cycleOn);
+
+  /* Invalid regions are rejected */
+  invalid.nbROI = 1;
+  invalid.weightROI = 100;
+  invalid.ROI[0].XSize = ISP_STATWINDOW_MIN - 1;
+  invalid.ROI[0].YSize = ISP_STATWINDOW_MIN;
+  ok &= (ISP_SVC_Stats_SetMetering(&SIM_hIsp, &invalid) != ISP_OK);
+  invalid.ROI[0].XSize = ISP_STATWINDOW_MIN;
+  invalid.weightROI = 101;
+  ok &= (ISP_SVC_Stats_SetMetering(&SIM_hIsp, &invalid) != ISP_OK);
+  invalid.weightROI = 100;
+  invalid.nbROI = ISP_METERING_ROI_MAX + 1;
+  ok &= (ISP_SVC_Stats_SetMetering(&SIM_hIsp, &invalid) != ISP_OK);
+
+  printf("%s\n", ok ? "PASS" : "FAIL");
+  return ok ? 0 : 1;
+}
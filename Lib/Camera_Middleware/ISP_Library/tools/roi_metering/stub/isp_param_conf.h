@@ -0,0 +1,26 @@
+/**
+ ******************************************************************************
+ * @file    isp_param_conf.h
+ * @author  AIS Application Team
+ * @brief   Host stand-in of the IQ parameters for the metering simulation
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __ISP_PARAM_CONF__H
+#define __ISP_PARAM_CONF__H
+
+/* The statistic engine does not use the IQ parameters */
+static const ISP_IQParamTypeDef ISP_IQParamCacheInit;
+
+#endif /* __ISP_PARAM_CONF__H */
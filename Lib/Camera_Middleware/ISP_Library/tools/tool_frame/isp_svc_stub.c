@@ -0,0 +1,53 @@
+/**
+ ******************************************************************************
+ * @file    isp_svc_stub.c
+ * @author  AIS Application Team
+ * @brief   No-op ISP services referenced by isp_cmd_parser.c and not used by
+ *          the tool transport test
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* The ISP headers are deliberately not included: every stub returns 0 (ISP_OK) */
+#define ISP_STUB(name) int name(void) { return 0; }
+
+ISP_STUB(ISP_GetExposureTarget)
+ISP_STUB(ISP_GetWBRefMode)
+ISP_STUB(ISP_ListWBRefModes)
+ISP_STUB(ISP_SVC_IQParam_Flush)
+ISP_STUB(ISP_SVC_IQParam_Get)
+ISP_STUB(ISP_SVC_ISP_GetBadPixel)
+ISP_STUB(ISP_SVC_ISP_GetBlackLevel)
+ISP_STUB(ISP_SVC_ISP_GetColorConv)
+ISP_STUB(ISP_SVC_ISP_GetDecimation)
+ISP_STUB(ISP_SVC_ISP_GetGain)
+ISP_STUB(ISP_SVC_ISP_GetStatArea)
+ISP_STUB(ISP_SVC_ISP_SetBadPixel)
+ISP_STUB(ISP_SVC_ISP_SetBlackLevel)
+ISP_STUB(ISP_SVC_ISP_SetColorConv)
+ISP_STUB(ISP_SVC_ISP_SetContrast)
+ISP_STUB(ISP_SVC_ISP_SetDemosaicing)
+ISP_STUB(ISP_SVC_ISP_SetGain)
+ISP_STUB(ISP_SVC_ISP_SetGamma)
+ISP_STUB(ISP_SVC_ISP_SetStatArea)
+ISP_STUB(ISP_SVC_ISP_SetStatRemoval)
+ISP_STUB(ISP_SVC_Misc_GetDCMIPPVersion)
+ISP_STUB(ISP_SVC_Misc_StartPreview)
+ISP_STUB(ISP_SVC_Misc_StopPreview)
+ISP_STUB(ISP_SVC_Sensor_GetExposure)
+ISP_STUB(ISP_SVC_Sensor_GetGain)
+ISP_STUB(ISP_SVC_Sensor_GetInfo)
+ISP_STUB(ISP_SVC_Sensor_SetExposure)
+ISP_STUB(ISP_SVC_Sensor_SetGain)
+ISP_STUB(ISP_SVC_Sensor_SetTestPattern)
+ISP_STUB(ISP_SetExposureTarget)
+ISP_STUB(ISP_SetWBRefMode)
@@ -0,0 +1,25 @@
+/**
+ ******************************************************************************
+ * @file    usb_device.h
+ * @author  AIS Application Team
+ * @brief   Host stand-in of the USB device initialization
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __USB_DEVICE__H__
+#define __USB_DEVICE__H__
+
+void MX_USB_DEVICE_Init(void);
+
+#endif /* __USB_DEVICE__H__ */
@@ -0,0 +1,29 @@
+/**
+ ******************************************************************************
+ * @file    usbd_cdc_if.h
+ * @author  AIS Application Team
+ * @brief   Host stand-in of the USB CDC interface: the tool transport test
+ *          implements the send function as a loopback to the host decoder
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __USBD_CDC_IF_H__
+#define __USBD_CDC_IF_H__
+
+#include <stdint.h>
+#include <string.h>
+
+uint32_t USB_CDC_Send_Wrapper_Function(uint8_t* buffer, uint32_t size);
+
+#endif /* __USBD_CDC_IF_H__ */
@@ -0,0 +1,123 @@
+/**
+ ******************************************************************************
+ * @file    tool_frame_decode.c
+ * @author  AIS Application Team
+ * @brief   Decode a capture of the binary tool transport (ISP middleware built
+ *          with ISP_MW_TOOL_FRAMING_SUPPORT): prints the command answers and
+ *          statistics events, and writes each frame dump to a file.
+ *            tool_frame_decode capture.bin [dump_prefix]
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "tool_frame_stream.h"
+
+typedef struct
+{
+  const char *prefix;
+  uint32_t nbDumps;
+} Decode_Ctx;
+
+static void OnMessage(void *ctx, uint8_t type, const uint8_t *data, uint32_t size)
+{
+  Decode_Ctx *d = ctx;
+  uint32_t i, count, recordSize, frameId;
+  const uint8_t *rec;
+  char name[256];
+  FILE *f;
+
+  switch (type)
+  {
+  case ISP_TOOL_FRAME_CMD:
+    /* ISP_Cmd_HeaderTypeDef: operation, id */
+    if (size >= 2)
+    {
+      printf("answer   id 0x%02x operation 0x%02x (%u bytes)\n", data[1], data[0], size);
+    }
+    break;
+
+  case ISP_TOOL_FRAME_DUMP:
+    snprintf(name, sizeof(name), "%s_%u.bin", d->prefix, d->nbDumps++);
+    f = fopen(name, "wb");
+    if ((f == NULL) || (fwrite(data, 1, size, f) != size))
+    {
+      fprintf(stderr, "can't write %s\n", name);
+      exit(1);
+    }
+    fclose(f);
+    printf("dump     %u bytes -> %s\n", size, name);
+    break;
+
+  case ISP_TOOL_FRAME_STATS:
+    /* Batch: count, record size, then records starting with ISP_Cmd_HeaderTypeDef, frame id and averages R, G, B, L */
+    if (size < ISP_TOOL_FRAME_STATS_HEADER_SIZE)
+    {
+      break;
+    }
+    count = data[0] | (data[1] << 8);
+    recordSize = data[2] | (data[3] << 8);
+    if ((recordSize < 12) || (ISP_TOOL_FRAME_STATS_HEADER_SIZE + count * recordSize > size))
+    {
+      printf("stats    malformed batch\n");
+      break;
+    }
+    for (i = 0; i < count; i++)
+    {
+      rec = data + ISP_TOOL_FRAME_STATS_HEADER_SIZE + i * recordSize;
+      frameId = rec[4] | (rec[5] << 8) | (rec[6] << 16) | ((uint32_t) rec[7] << 24);
+      printf("stats    id 0x%02x frame %u R %u G %u B %u L %u\n", rec[1], frameId, rec[8], rec[9], rec[10], rec[11]);
+    }
+    break;
+
+  default:
+    printf("unknown  type %u (%u bytes)\n", type, size);
+    break;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  Decode_Ctx ctx = { 0 };
+  ToolFrame_Stream s;
+  uint8_t buf[65536];
+  size_t n;
+  FILE *f;
+
+  if (argc < 2)
+  {
+    fprintf(stderr, "usage: %s capture.bin [dump_prefix]\n", argv[0]);
+    return 1;
+  }
+
+  f = fopen(argv[1], "rb");
+  if (f == NULL)
+  {
+    fprintf(stderr, "can't open %s\n", argv[1]);
+    return 1;
+  }
+  ctx.prefix = (argc > 2) ? argv[2] : "dump";
+
+  ToolFrame_StreamInit(&s, OnMessage, &ctx);
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+  {
+    ToolFrame_StreamFeed(&s, buf, (uint32_t) n);
+  }
+  fclose(f);
+
+  printf("%u frames, %u messages, %u lost, %u corrupted, %u bytes skipped\n", s.nbFrames, s.nbMessages, s.nbLost,
+         s.nbCorrupted, s.nbResync);
+  ToolFrame_StreamFree(&s);
+
+  return 0;
+}
@@ -0,0 +1,289 @@
+/**
+ ******************************************************************************
+ * @file    tool_frame_loopback.c
+ * @author  AIS Application Team
+ * @brief   Throughput test of the IQ tuning tool transport over a loopback
+ *          link: the command parser answers frame dump and statistics
+ *          requests through isp_tool_com.c, and the link bytes are counted
+ *          and, with ISP_MW_TOOL_FRAMING_SUPPORT, decoded and checked by the
+ *          host decoder. Built with and without the framing to compare.
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "isp_core.h"
+#include "isp_services.h"
+#include "isp_cmd_parser.h"
+#include "isp_tool_com.h"
+#include "usbd_cdc_if.h"
+#ifdef ISP_MW_TOOL_FRAMING_SUPPORT
+#include "tool_frame_stream.h"
+#endif
+
+#define TEST_WIDTH            2592U
+#define TEST_HEIGHT           1944U
+#define TEST_NB_STAT_CYCLES   32U
+#define TEST_CMD_OP_GET       0x01U
+#define TEST_CMD_STATISTICUP  0x10U
+#define TEST_CMD_STATISTICDOWN 0x11U
+#define TEST_CMD_DUMPFRAME    0x13U
+
+/* Link rates used to estimate the transfer time */
+#define TEST_USB_FS_BPS       (1000000.0)   /* USB full speed CDC, bytes per second */
+#define TEST_UART_BPS         (92160.0)     /* UART 921600 bauds, 8N1 */
+
+uint32_t current_awb_profId;
+
+static ISP_HandleTypeDef hIsp;
+static uint8_t *testFrame;
+static ISP_DumpFrameMetaTypeDef testMeta;
+
+/* Statistics requests registered by the command parser */
+static ISP_stat_ready_cb statCb[2];
+static ISP_SVC_StatStateTypeDef *statState;
+
+/* Link */
+static uint64_t linkBytes;
+static uint32_t linkTransfers;
+#ifdef ISP_MW_TOOL_FRAMING_SUPPORT
+static ToolFrame_Stream stream;
+static const uint8_t *expectedDump;
+static uint32_t expectedDumpSize, nbDumpsOk, nbStatsOk, nbAnswers;
+#endif
+
+/* Loopback link: count, and decode with the framing */
+uint32_t USB_CDC_Send_Wrapper_Function(uint8_t* buffer, uint32_t size)
+{
+  linkBytes += size;
+  linkTransfers++;
+#ifdef ISP_MW_TOOL_FRAMING_SUPPORT
+  ToolFrame_StreamFeed(&stream, buffer, size);
+#endif
+  return 0;
+}
+
+void MX_USB_DEVICE_Init(void)
+{
+}
+
+ISP_StatusTypeDef ISP_SVC_Dump_GetFrame(ISP_HandleTypeDef *pIsp, uint32_t **pBuffer, ISP_DumpFrameMetaTypeDef *pMeta)
+{
+  (void) pIsp;
+  *pBuffer = (uint32_t *) testFrame;
+  *pMeta = testMeta;
+  return ISP_OK;
+}
+
+ISP_StatusTypeDef ISP_SVC_Stats_GetNext(ISP_HandleTypeDef *pIsp, ISP_stat_ready_cb callback, ISP_AlgoTypeDef *pAlgo,
+                                        ISP_SVC_StatStateTypeDef *pStats, ISP_SVC_StatLocation location,
+                                        ISP_SVC_StatType type, uint32_t frameDelay)
+{
+  (void) pIsp;
+  (void) pAlgo;
+  (void) type;
+  (void) frameDelay;
+  statCb[(location == ISP_STAT_LOC_UP) ? 0 : 1] = callback;
+  statState = pStats;
+  return ISP_OK;
+}
+
+uint32_t ISP_SVC_Misc_GetMainFrameId(ISP_HandleTypeDef *pIsp)
+{
+  return pIsp->MainPipe_FrameCount;
+}
+
+#ifdef ISP_MW_TOOL_FRAMING_SUPPORT
+static void OnMessage(void *ctx, uint8_t type, const uint8_t *data, uint32_t size)
+{
+  uint32_t i, count, recordSize, frameId;
+  const uint8_t *rec;
+
+  (void) ctx;
+  switch (type)
+  {
+  case ISP_TOOL_FRAME_CMD:
+    nbAnswers++;
+    break;
+
+  case ISP_TOOL_FRAME_DUMP:
+    if ((size == expectedDumpSize) && (memcmp(data, expectedDump, size) == 0))
+    {
+      nbDumpsOk++;
+    }
+    break;
+
+  case ISP_TOOL_FRAME_STATS:
+    count = data[0] | (data[1] << 8);
+    recordSize = data[2] | (data[3] << 8);
+    for (i = 0; i < count; i++)
+    {
+      /* Each event carries averages derived from its frame id (see RunStats) */
+      rec = data + ISP_TOOL_FRAME_STATS_HEADER_SIZE + i * recordSize;
+      memcpy(&frameId, rec + 4, sizeof(frameId));
+      if ((rec[8] == (uint8_t) frameId) && (rec[11] == (uint8_t) (frameId + rec[1])))
+      {
+        nbStatsOk++;
+      }
+    }
+    break;
+  }
+}
+#endif
+
+static void SendCommand(uint8_t id)
+{
+  uint8_t cmd[1000] = { 0 };
+
+  cmd[0] = TEST_CMD_OP_GET;
+  cmd[1] = id;
+  ISP_CmdParser_ProcessCommand(&hIsp, cmd);
+}
+
+static double Now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* Synthetic RAW8 frames (RGGB) */
+static void MakeFrame(int kind)
+{
+  uint32_t x, y, v, c;
+
+  srand(1);
+  for (y = 0; y < TEST_HEIGHT; y++)
+  {
+    for (x = 0; x < TEST_WIDTH; x++)
+    {
+      c = (y & 1) * 2 + (x & 1);
+      switch (kind)
+      {
+      case 0:
+        /* Sensor color bars test pattern */
+        v = ((x * 8 / TEST_WIDTH) & (1U << (c == 0 ? 0 : (c == 3 ? 2 : 1)))) ? 220 : 16;
+        break;
+      case 1:
+        /* Dark frame for the black level calibration: pedestal plus low noise */
+        v = 64 + ((rand() & 7) == 0);
+        break;
+      default:
+        /* Scene: vignetted gradient with per channel gains and sensor noise */
+        v = 40 + (x * 120 / TEST_WIDTH) * (c == 0 ? 5 : (c == 3 ? 3 : 8)) / 8 - (y * 30 / TEST_HEIGHT);
+        v += (rand() % 5) - 2;
+        break;
+      }
+      testFrame[y * TEST_WIDTH + x] = (uint8_t) v;
+    }
+  }
+}
+
+static void RunDump(const char *name, int kind)
+{
+  uint64_t bytes0 = linkBytes;
+  uint32_t transfers0 = linkTransfers;
+  double t0, wire;
+
+  MakeFrame(kind);
+#ifdef ISP_MW_TOOL_FRAMING_SUPPORT
+  expectedDump = testFrame;
+  expectedDumpSize = testMeta.size;
+#endif
+
+  t0 = Now();
+  SendCommand(TEST_CMD_DUMPFRAME);
+  t0 = Now() - t0;
+
+  wire = (double) (linkBytes - bytes0);
+  printf("dump %-12s %8u bytes -> %9.0f on link (%5.1f%%) %5u transfers  USB FS %5.2f s  UART %6.1f s",
+         name, testMeta.size, wire, 100.0 * wire / testMeta.size, linkTransfers - transfers0, wire / TEST_USB_FS_BPS,
+         wire / TEST_UART_BPS);
+#ifdef ISP_MW_TOOL_FRAMING_SUPPORT
+  /* Encoder throughput on the host, the target one is in the same order of magnitude scaled by the CPU clock */
+  printf("  encode %4.0f MB/s", testMeta.size / t0 / 1e6);
+#endif
+  printf("\n");
+}
+
+static void RunStats(void)
+{
+  uint64_t bytes0 = linkBytes;
+  uint32_t transfers0 = linkTransfers, i, frame;
+
+  for (i = 0; i < TEST_NB_STAT_CYCLES; i++)
+  {
+    /* The tool requests the up and down statistics, both ready at the end of the cycle */
+    SendCommand(TEST_CMD_STATISTICUP);
+    SendCommand(TEST_CMD_STATISTICDOWN);
+
+    hIsp.MainPipe_FrameCount += 10;
+    frame = hIsp.MainPipe_FrameCount;
+    memset(statState, 0, sizeof(*statState));
+    statState->upFrameIdEnd = frame;
+    statState->downFrameIdEnd = frame;
+    statState->up.averageR = (uint8_t) frame;
+    statState->up.averageL = (uint8_t) (frame + TEST_CMD_STATISTICUP);
+    statState->down.averageR = (uint8_t) frame;
+    statState->down.averageL = (uint8_t) (frame + TEST_CMD_STATISTICDOWN);
+
+    /* Background process: statistics callbacks then poll */
+    statCb[0](NULL);
+    statCb[1](NULL);
+    ISP_CmdParser_Poll(&hIsp);
+  }
+
+  printf("stats %3u events             -> %9lu on link          %5u transfers\n", 2 * TEST_NB_STAT_CYCLES,
+         (unsigned long) (linkBytes - bytes0), linkTransfers - transfers0);
+}
+
+int main(void)
+{
+  int ok = 1;
+
+#ifdef ISP_MW_TOOL_FRAMING_SUPPORT
+  printf("== binary framing (ISP_MW_TOOL_FRAMING_SUPPORT)\n");
+  ToolFrame_StreamInit(&stream, OnMessage, NULL);
+#else
+  printf("== legacy transport\n");
+#endif
+
+  testMeta.width = TEST_WIDTH;
+  testMeta.height = TEST_HEIGHT;
+  testMeta.pitch = TEST_WIDTH;
+  testMeta.size = TEST_WIDTH * TEST_HEIGHT;
+  testMeta.format = ISP_FORMAT_RAW8;
+  testFrame = malloc(testMeta.size);
+
+  ISP_ToolCom_Init();
+  RunDump("test pattern", 0);
+  RunDump("dark", 1);
+  RunDump("scene", 2);
+  RunStats();
+
+#ifdef ISP_MW_TOOL_FRAMING_SUPPORT
+  /* Answers to the dump requests, every dump and statistics event decoded identical, no frame lost */
+  ok &= (nbAnswers == 3) && (nbDumpsOk == 3) && (nbStatsOk == 2 * TEST_NB_STAT_CYCLES);
+  ok &= (stream.nbLost == 0) && (stream.nbCorrupted == 0) && (stream.nbResync == 0);
+  printf("decoded: %u answers, %u dumps, %u statistics events, %u frames\n", nbAnswers, nbDumpsOk, nbStatsOk,
+         stream.nbFrames);
+  ToolFrame_StreamFree(&stream);
+  printf("%s\n", ok ? "PASS" : "FAIL");
+#endif
+
+  free(testFrame);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,147 @@
+/**
+ ******************************************************************************
+ * @file    tool_frame_stream.c
+ * @author  AIS Application Team
+ * @brief   Host decoder of the IQ tuning tool binary frames
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "tool_frame_stream.h"
+
+/* Sanity limit of a frame payload: a valid header announcing more is a desynchronization */
+#define STREAM_PAYLOAD_MAX    (64U * 1024U * 1024U)
+
+static void Reserve(uint8_t **p, uint32_t *cap, uint32_t size)
+{
+  if (size > *cap)
+  {
+    *cap = size;
+    *p = realloc(*p, *cap);
+    if (*p == NULL)
+    {
+      fprintf(stderr, "out of memory\n");
+      exit(1);
+    }
+  }
+}
+
+static void HandleFrame(ToolFrame_Stream *s)
+{
+  ISP_ToolFrame_HeaderTypeDef *hdr = &s->hdr;
+
+  s->nbFrames++;
+
+  if (s->synced && (hdr->seq != s->nextSeq))
+  {
+    /* Frames lost: drop the message being reassembled */
+    s->nbLost++;
+    s->inMessage = 0;
+  }
+  s->synced = 1;
+  s->nextSeq = hdr->seq + 1;
+
+  if (hdr->flags & ISP_TOOL_FRAME_FLAG_FIRST)
+  {
+    s->inMessage = 1;
+    s->msgLen = 0;
+  }
+  if (!s->inMessage)
+  {
+    return;
+  }
+
+  Reserve(&s->msg, &s->msgCap, s->msgLen + hdr->rawSize);
+  if (ISP_ToolFrame_Decode(hdr, s->payload, s->msg + s->msgLen, hdr->rawSize) != hdr->rawSize)
+  {
+    s->nbCorrupted++;
+    s->inMessage = 0;
+    return;
+  }
+  s->msgLen += hdr->rawSize;
+
+  if (hdr->flags & ISP_TOOL_FRAME_FLAG_LAST)
+  {
+    s->inMessage = 0;
+    s->nbMessages++;
+    if (s->onMessage != NULL)
+    {
+      s->onMessage(s->ctx, hdr->type, s->msg, s->msgLen);
+    }
+  }
+}
+
+void ToolFrame_StreamInit(ToolFrame_Stream *s, ToolFrame_MessageCb onMessage, void *ctx)
+{
+  memset(s, 0, sizeof(*s));
+  s->onMessage = onMessage;
+  s->ctx = ctx;
+}
+
+void ToolFrame_StreamFeed(ToolFrame_Stream *s, const uint8_t *data, uint32_t size)
+{
+  uint32_t n;
+
+  while (size > 0)
+  {
+    if (s->headerLen < ISP_TOOL_FRAME_HEADER_SIZE)
+    {
+      /* Header */
+      s->header[s->headerLen++] = *data++;
+      size--;
+      if (s->headerLen < ISP_TOOL_FRAME_HEADER_SIZE)
+      {
+        continue;
+      }
+
+      if ((ISP_ToolFrame_ParseHeader(s->header, &s->hdr) != 0) || (s->hdr.size > STREAM_PAYLOAD_MAX) ||
+          (s->hdr.rawSize > STREAM_PAYLOAD_MAX))
+      {
+        /* Not a header: skip one byte and search again */
+        memmove(s->header, s->header + 1, ISP_TOOL_FRAME_HEADER_SIZE - 1);
+        s->headerLen--;
+        s->nbResync++;
+        continue;
+      }
+
+      s->payloadLen = 0;
+      Reserve(&s->payload, &s->payloadCap, s->hdr.size);
+    }
+    else
+    {
+      /* Payload */
+      n = s->hdr.size - s->payloadLen;
+      n = (n > size) ? size : n;
+      memcpy(s->payload + s->payloadLen, data, n);
+      s->payloadLen += n;
+      data += n;
+      size -= n;
+    }
+
+    if ((s->headerLen == ISP_TOOL_FRAME_HEADER_SIZE) && (s->payloadLen == s->hdr.size))
+    {
+      HandleFrame(s);
+      s->headerLen = 0;
+    }
+  }
+}
+
+void ToolFrame_StreamFree(ToolFrame_Stream *s)
+{
+  free(s->payload);
+  free(s->msg);
+  s->payload = NULL;
+  s->msg = NULL;
+}
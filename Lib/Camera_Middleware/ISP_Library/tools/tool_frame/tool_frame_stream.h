@@ -0,0 +1,58 @@
+/**
+ ******************************************************************************
+ * @file    tool_frame_stream.h
+ * @author  AIS Application Team
+ * @brief   Host decoder of the IQ tuning tool binary frames: resynchronizes
+ *          on the frame headers, decodes the payloads and reassembles the
+ *          split ones
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef __TOOL_FRAME_STREAM_H
+#define __TOOL_FRAME_STREAM_H
+
+#include <stdint.h>
+#include "isp_tool_frame.h"
+
+/* Called for each complete message (all the frames from FIRST to LAST) */
+typedef void (*ToolFrame_MessageCb)(void *ctx, uint8_t type, const uint8_t *data, uint32_t size);
+
+typedef struct
+{
+  ToolFrame_MessageCb onMessage;
+  void *ctx;
+  uint8_t header[ISP_TOOL_FRAME_HEADER_SIZE];
+  uint32_t headerLen;
+  ISP_ToolFrame_HeaderTypeDef hdr;
+  uint8_t *payload;             /* Payload of the current frame, as received */
+  uint32_t payloadLen;
+  uint32_t payloadCap;
+  uint8_t *msg;                 /* Decoded message being reassembled */
+  uint32_t msgLen;
+  uint32_t msgCap;
+  int inMessage;
+  int synced;
+  uint16_t nextSeq;
+  /* Counters */
+  uint32_t nbFrames;
+  uint32_t nbMessages;
+  uint32_t nbLost;              /* Sequence number gaps */
+  uint32_t nbResync;            /* Bytes skipped to find a valid header */
+  uint32_t nbCorrupted;         /* Payloads failing to decode */
+} ToolFrame_Stream;
+
+void ToolFrame_StreamInit(ToolFrame_Stream *s, ToolFrame_MessageCb onMessage, void *ctx);
+void ToolFrame_StreamFeed(ToolFrame_Stream *s, const uint8_t *data, uint32_t size);
+void ToolFrame_StreamFree(ToolFrame_Stream *s);
+
+#endif /* __TOOL_FRAME_STREAM_H */
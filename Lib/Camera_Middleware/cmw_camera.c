@@ -29,6 +29,10 @@
 #include "cmw_vd66gy.h"
 #include "cmw_vd1941.h"
 #include "cmw_vd5941.h"
+#include <string.h>
+
+#define CMW_MIN(a, b)            (((a) < (b)) ? (a) : (b))
+#define CMW_CLAMP(v, lo, hi)     (((v) < (lo)) ? (lo) : (((v) > (hi)) ? (hi) : (v)))
 
 typedef struct
 {
@@ -81,6 +85,10 @@ static union
 int is_camera_init = 0;
 int is_camera_started = 0;
 
+/* Pipe configuration currently programmed, used by CMW_CAMERA_SwitchPipeConfig() to only write changes */
+static CMW_PipeConfig_t pipe_current_conf[DCMIPP_NUM_OF_PIPES];
+static int is_pipe_conf_valid[DCMIPP_NUM_OF_PIPES];
+
 static void DCMIPP_MspInit(DCMIPP_HandleTypeDef *hdcmipp);
 static void DCMIPP_MspDeInit(DCMIPP_HandleTypeDef *hdcmipp);
 #if defined(USE_IMX335_SENSOR)
@@ -120,6 +128,94 @@ int32_t CMW_CAMERA_SetPipeConfig(uint32_t pipe, DCMIPP_Conf_t *p_conf)
   return CMW_CAMERA_SetPipe(&hcamera_dcmipp, pipe, p_conf);
 }
 
+/**
+  * @brief  Switch a pipe already configured by CMW_CAMERA_SetPipeConfig() to another resolved configuration,
+  *         typically taken from a CMW_UTILS pipe configuration cache. Only the crop, decimation, downsize
+  *         and pitch settings that differ from the current ones are written, so it can run between two
+  *         frames (e.g. from the vsync event) to change the output size per frame.
+  * @param  pipe  Dcmipp pipe.
+  * @param  p_conf  Resolved pipe configuration
+  * @retval CMW status
+  */
+int32_t CMW_CAMERA_SwitchPipeConfig(uint32_t pipe, const CMW_PipeConfig_t *p_conf)
+{
+  CMW_PipeConfig_t *cur;
+  int ret;
+
+  if ((pipe == DCMIPP_PIPE0) || (pipe >= DCMIPP_NUM_OF_PIPES) || (p_conf == NULL))
+  {
+    return CMW_ERROR_WRONG_PARAM;
+  }
+
+  if (!is_pipe_conf_valid[pipe])
+  {
+    return CMW_ERROR_NO_INIT;
+  }
+  cur = &pipe_current_conf[pipe];
+
+  if (memcmp(&p_conf->crop, &cur->crop, sizeof(cur->crop)) != 0)
+  {
+    if (p_conf->crop.VSize != 0 && p_conf->crop.HSize != 0)
+    {
+      ret = HAL_DCMIPP_PIPE_SetCropConfig(&hcamera_dcmipp, pipe, &p_conf->crop);
+      if (ret != HAL_OK)
+      {
+        return CMW_ERROR_COMPONENT_FAILURE;
+      }
+
+      if (cur->crop.VSize == 0 || cur->crop.HSize == 0)
+      {
+        ret = HAL_DCMIPP_PIPE_EnableCrop(&hcamera_dcmipp, pipe);
+        if (ret != HAL_OK)
+        {
+          return CMW_ERROR_COMPONENT_FAILURE;
+        }
+      }
+    }
+    else
+    {
+      ret = HAL_DCMIPP_PIPE_DisableCrop(&hcamera_dcmipp, pipe);
+      if (ret != HAL_OK)
+      {
+        return CMW_ERROR_COMPONENT_FAILURE;
+      }
+    }
+    cur->crop = p_conf->crop;
+  }
+
+  if (memcmp(&p_conf->dec, &cur->dec, sizeof(cur->dec)) != 0)
+  {
+    ret = HAL_DCMIPP_PIPE_SetDecimationConfig(&hcamera_dcmipp, pipe, &p_conf->dec);
+    if (ret != HAL_OK)
+    {
+      return CMW_ERROR_COMPONENT_FAILURE;
+    }
+    cur->dec = p_conf->dec;
+  }
+
+  if (memcmp(&p_conf->down, &cur->down, sizeof(cur->down)) != 0)
+  {
+    ret = HAL_DCMIPP_PIPE_SetDownsizeConfig(&hcamera_dcmipp, pipe, &p_conf->down);
+    if (ret != HAL_OK)
+    {
+      return CMW_ERROR_COMPONENT_FAILURE;
+    }
+    cur->down = p_conf->down;
+  }
+
+  if (p_conf->pitch != cur->pitch)
+  {
+    ret = HAL_DCMIPP_PIPE_SetPitch(&hcamera_dcmipp, pipe, p_conf->pitch);
+    if (ret != HAL_OK)
+    {
+      return CMW_ERROR_COMPONENT_FAILURE;
+    }
+    cur->pitch = p_conf->pitch;
+  }
+
+  return CMW_ERROR_NONE;
+}
+
 /**
   * @brief  Initializes the camera.
   * @param  initConf  Camera sensor requested config
@@ -360,6 +456,7 @@ int32_t CMW_CAMERA_DeInit(void)
   {
     return CMW_ERROR_PERIPH_FAILURE;
   }
+  memset(is_pipe_conf_valid, 0, sizeof(is_pipe_conf_valid));
 
   if (is_camera_init <= 0)
   {
@@ -572,6 +669,91 @@ int32_t CMW_CAMERA_GetSensorInfo(ISP_SensorInfoTypeDef *info)
 }
 
 
+/**
+  * @brief  Set the regions of interest on which the AEC meters the luminance, e.g. the objects detected
+  *         on the frames of a pipe. The AEC then targets a luminance weighted between these regions and the
+  *         whole frame.
+  * @param  pipe   Pipe on which the regions are located
+  * @param  p_roi  Regions of interest, normalized in the pipe output frame
+  * @param  nb_roi Number of regions (0 to meter the whole frame only). Regions above ISP_METERING_ROI_MAX are ignored
+  * @param  weight Weight (0 to 100) of the regions average luminance
+  * @retval CMW status
+  */
+int32_t CMW_CAMERA_SetMeteringROI(uint32_t pipe, const CMW_MeteringROI_t *p_roi, uint32_t nb_roi, uint32_t weight)
+{
+  ISP_MeteringTypeDef metering;
+  ISP_StatAreaTypeDef *area;
+  uint32_t i, x0, y0, w, h;
+  float x1, y1, x2, y2;
+  int32_t ret;
+
+  if ((pipe >= DCMIPP_NUM_OF_PIPES) || ((p_roi == NULL) && (nb_roi != 0)) || (weight > 100))
+  {
+    return CMW_ERROR_WRONG_PARAM;
+  }
+
+  if (Camera_Drv.SetMeteringROI == NULL)
+  {
+    return CMW_ERROR_FEATURE_NOT_SUPPORTED;
+  }
+
+  if (!is_pipe_conf_valid[pipe])
+  {
+    return CMW_ERROR_NO_INIT;
+  }
+
+  /* The pipe output frame is the (decimated and downsized) crop window of the sensor frame */
+  if ((pipe_current_conf[pipe].crop.HSize != 0) && (pipe_current_conf[pipe].crop.VSize != 0))
+  {
+    x0 = pipe_current_conf[pipe].crop.HStart;
+    y0 = pipe_current_conf[pipe].crop.VStart;
+    w = pipe_current_conf[pipe].crop.HSize;
+    h = pipe_current_conf[pipe].crop.VSize;
+  }
+  else
+  {
+    x0 = 0;
+    y0 = 0;
+    w = camera_conf.width;
+    h = camera_conf.height;
+  }
+
+  metering.nbROI = (nb_roi > ISP_METERING_ROI_MAX) ? ISP_METERING_ROI_MAX : nb_roi;
+  metering.weightROI = weight;
+  for (i = 0; i < metering.nbROI; i++)
+  {
+    x1 = CMW_CLAMP(p_roi[i].x_center - p_roi[i].width / 2, 0.0f, 1.0f);
+    x2 = CMW_CLAMP(p_roi[i].x_center + p_roi[i].width / 2, 0.0f, 1.0f);
+    y1 = CMW_CLAMP(p_roi[i].y_center - p_roi[i].height / 2, 0.0f, 1.0f);
+    y2 = CMW_CLAMP(p_roi[i].y_center + p_roi[i].height / 2, 0.0f, 1.0f);
+
+    area = &metering.ROI[i];
+    area->X0 = x0 + (uint32_t) (x1 * w);
+    area->Y0 = y0 + (uint32_t) (y1 * h);
+    area->XSize = (uint32_t) ((x2 - x1) * w);
+    area->YSize = (uint32_t) ((y2 - y1) * h);
+
+    /* Keep a measurable window inside the frame */
+    if (area->XSize < ISP_STATWINDOW_MIN)
+    {
+      area->XSize = ISP_STATWINDOW_MIN;
+      area->X0 = CMW_MIN(area->X0, x0 + w - ISP_STATWINDOW_MIN);
+    }
+    if (area->YSize < ISP_STATWINDOW_MIN)
+    {
+      area->YSize = ISP_STATWINDOW_MIN;
+      area->Y0 = CMW_MIN(area->Y0, y0 + h - ISP_STATWINDOW_MIN);
+    }
+  }
+
+  ret = Camera_Drv.SetMeteringROI(&camera_bsp, &metering);
+  if (ret != CMW_ERROR_NONE)
+  {
+    return CMW_ERROR_WRONG_PARAM;
+  }
+
+  return CMW_ERROR_NONE;
+}
 
 int32_t CMW_CAMERA_Run()
 {
@@ -1266,6 +1448,13 @@ static int32_t CMW_CAMERA_SetPipe(DCMIPP_HandleTypeDef *hdcmipp, uint32_t pipe,
   {
     return CMW_ERROR_COMPONENT_FAILURE;
   }
+
+  pipe_current_conf[pipe].crop = crop_conf;
+  pipe_current_conf[pipe].dec = dec_conf;
+  pipe_current_conf[pipe].down = down_conf;
+  pipe_current_conf[pipe].pitch = pipe_conf.PixelPipePitch;
+  is_pipe_conf_valid[pipe] = 1;
+
   return HAL_OK;
 }
 
@@ -85,6 +85,24 @@ typedef struct {
   CMW_Manual_Configuration_t manual_conf;
 } DCMIPP_Conf_t;
 
+/* Resolved crop/decimation/downsize/pitch of a pipe, see CMW_UTILS_SolvePipeConfig().
+ * A crop size of 0 means crop disabled */
+typedef struct {
+  DCMIPP_CropConfTypeDef crop;
+  DCMIPP_DecimationConfTypeDef dec;
+  DCMIPP_DownsizeTypeDef down;
+  uint32_t pitch;
+} CMW_PipeConfig_t;
+
+/* Region of interest to be metered by the AEC, normalized (0.0 to 1.0) in the pipe output frame,
+ * as objects detected on that frame */
+typedef struct {
+  float x_center;
+  float y_center;
+  float width;
+  float height;
+} CMW_MeteringROI_t;
+
 /* Camera capture mode */
 #define CAMERA_MODE_CONTINUOUS          DCMIPP_MODE_CONTINUOUS
 #define CAMERA_MODE_SNAPSHOT            DCMIPP_MODE_SNAPSHOT
@@ -195,6 +213,8 @@ int32_t CMW_CAMERA_Init( CMW_CameraInit_t *init_conf );
 int32_t CMW_CAMERA_DeInit();
 int32_t CMW_CAMERA_Run();
 int32_t CMW_CAMERA_SetPipeConfig(uint32_t pipe, DCMIPP_Conf_t *p_conf);
+int32_t CMW_CAMERA_SwitchPipeConfig(uint32_t pipe, const CMW_PipeConfig_t *p_conf);
+int32_t CMW_CAMERA_SetMeteringROI(uint32_t pipe, const CMW_MeteringROI_t *p_roi, uint32_t nb_roi, uint32_t weight);
 
 int32_t CMW_CAMERA_Start(uint32_t pipe, uint8_t *pbuff, uint32_t Mode);
 int32_t CMW_CAMERA_DoubleBufferStart(uint32_t pipe, uint8_t *pbuff1, uint8_t *pbuff2, uint32_t Mode);
@@ -19,6 +19,7 @@
 #include "cmw_utils.h"
 
 #include <assert.h>
+#include <string.h>
 
 #ifndef MIN
 #define MIN(a,b) ((a)<(b)?(a):(b))
@@ -28,6 +29,11 @@
 #define MAX(a,b) ((a)>(b)?(a):(b))
 #endif
 
+/* Downsize ratio is 8192 * in / out on 16 bits: the downsize engine handles in / out in [1, 8) */
+#define CMW_UTILS_DOWN_RATIO_ONE 8192U
+#define CMW_UTILS_DOWN_RATIO_MAX 65535U
+#define CMW_UTILS_DEC_RATIO_MAX  8U
+
 static void CMW_UTILS_get_crop_config(uint32_t cam_width, uint32_t cam_height, uint32_t pipe_width,
                                       uint32_t pipe_height, DCMIPP_CropConfTypeDef *crop);
 static void CMW_UTILS_get_crop_config_from_manual(CMW_Manual_Configuration_t *conf, DCMIPP_CropConfTypeDef *crop);
@@ -39,6 +45,9 @@ static void CMW_UTILS_get_scale_configs(DCMIPP_Conf_t *p_conf, float ratio_width
 static void CMW_UTILS_get_decimation_config_from_manual(CMW_Manual_Configuration_t *conf,
                                                         DCMIPP_DecimationConfTypeDef *dec);
 static void CMW_UTILS_get_downsize_config_from_manual(CMW_Manual_Configuration_t *conf, DCMIPP_DownsizeTypeDef *down);
+static uint32_t CMW_UTILS_get_dec_ratio_from_decimal_ratio(int dec_ratio, int is_vertical);
+static int32_t CMW_UTILS_solve_axis(uint32_t num, uint32_t den, int is_vertical, uint32_t *dec_ratio,
+                                    uint32_t *down_ratio, uint32_t *down_div);
 
 void CMW_UTILS_GetPipeConfig(uint32_t cam_width, uint32_t cam_height, DCMIPP_Conf_t *p_conf,
                              DCMIPP_CropConfTypeDef *crop, DCMIPP_DecimationConfTypeDef *dec,
@@ -75,6 +84,160 @@ void CMW_UTILS_GetPipeConfig(uint32_t cam_width, uint32_t cam_height, DCMIPP_Con
   CMW_UTILS_get_scale_configs(p_conf, ratio_width, ratio_height, dec, down);
 }
 
+/*
+ * Same pipe output as CMW_UTILS_GetPipeConfig() but resolved with integer arithmetic and to minimize the
+ * DCMIPP bandwidth: each axis is decimated as much as possible before the downsize engine, which is left
+ * with a ratio in [1, 2) when the overall ratio allows it. Returns CMW_ERROR_WRONG_PARAM when the requested
+ * output cannot be reached (upscale or ratio of 64 or more).
+ */
+int32_t CMW_UTILS_SolvePipeConfig(uint32_t cam_width, uint32_t cam_height, const DCMIPP_Conf_t *p_conf,
+                                  CMW_PipeConfig_t *conf)
+{
+  const uint32_t out_width = p_conf->output_width;
+  const uint32_t out_height = p_conf->output_height;
+  uint32_t h_num, h_den, v_num, v_den;
+  int32_t ret;
+
+  memset(conf, 0, sizeof(*conf));
+  conf->pitch = out_width * p_conf->output_bpp;
+
+  if (p_conf->mode == CAM_Aspect_ratio_manual)
+  {
+    CMW_Manual_Configuration_t manual = p_conf->manual_conf;
+
+    CMW_UTILS_get_crop_config_from_manual(&manual, &conf->crop);
+    CMW_UTILS_get_decimation_config_from_manual(&manual, &conf->dec);
+    CMW_UTILS_get_downsize_config_from_manual(&manual, &conf->down);
+
+    return CMW_ERROR_NONE;
+  }
+
+  if ((out_width == 0) || (out_height == 0))
+  {
+    return CMW_ERROR_WRONG_PARAM;
+  }
+
+  if (p_conf->mode == CAM_Aspect_ratio_crop)
+  {
+    /* Largest centered window with the output aspect ratio */
+    if ((uint64_t)cam_width * out_height >= (uint64_t)cam_height * out_width)
+    {
+      conf->crop.VSize = cam_height;
+      conf->crop.HSize = (uint32_t)(((uint64_t)cam_height * out_width) / out_height);
+    }
+    else
+    {
+      conf->crop.HSize = cam_width;
+      conf->crop.VSize = (uint32_t)(((uint64_t)cam_width * out_height) / out_width);
+    }
+    conf->crop.HStart = (cam_width - conf->crop.HSize + 1) / 2;
+    conf->crop.VStart = (cam_height - conf->crop.VSize + 1) / 2;
+    conf->crop.PipeArea = DCMIPP_POSITIVE_AREA;
+    h_num = conf->crop.HSize;
+    v_num = conf->crop.VSize;
+    h_den = out_width;
+    v_den = out_height;
+  }
+  else if (p_conf->mode == CAM_Aspect_ratio_fit)
+  {
+    h_num = cam_width;
+    v_num = cam_height;
+    h_den = out_width;
+    v_den = out_height;
+  }
+  else if (p_conf->mode == CAM_Aspect_ratio_fullscreen)
+  {
+    h_num = cam_height;
+    v_num = cam_height;
+    h_den = out_height;
+    v_den = out_height;
+  }
+  else
+  {
+    return CMW_ERROR_WRONG_PARAM;
+  }
+
+  ret = CMW_UTILS_solve_axis(h_num, h_den, 0, &conf->dec.HRatio, &conf->down.HRatio, &conf->down.HDivFactor);
+  if (ret != CMW_ERROR_NONE)
+  {
+    return ret;
+  }
+  ret = CMW_UTILS_solve_axis(v_num, v_den, 1, &conf->dec.VRatio, &conf->down.VRatio, &conf->down.VDivFactor);
+  if (ret != CMW_ERROR_NONE)
+  {
+    return ret;
+  }
+  conf->down.HSize = out_width;
+  conf->down.VSize = out_height;
+
+  return CMW_ERROR_NONE;
+}
+
+/*
+ * Solve the pipe configuration of every (sensor mode, output size) pair once, so that switching between
+ * model input sizes at run time does not recompute them. entries must hold nb_cam * nb_out elements.
+ */
+int32_t CMW_UTILS_PipeConfigCache_Build(CMW_UTILS_PipeConfigCache_t *cache, CMW_UTILS_PipeConfigEntry_t *entries,
+                                        uint32_t max_entries, const CMW_UTILS_Size_t *cam_sizes, uint32_t nb_cam,
+                                        const CMW_UTILS_Size_t *out_sizes, uint32_t nb_out,
+                                        const DCMIPP_Conf_t *p_conf)
+{
+  CMW_UTILS_PipeConfigEntry_t *entry = entries;
+  DCMIPP_Conf_t conf = *p_conf;
+  uint32_t i, j;
+  int32_t ret;
+
+  cache->entries = entries;
+  cache->nb_entries = 0;
+
+  if ((nb_cam == 0) || (nb_out == 0) || (nb_out > max_entries / nb_cam))
+  {
+    return CMW_ERROR_WRONG_PARAM;
+  }
+
+  for (i = 0; i < nb_cam; i++)
+  {
+    for (j = 0; j < nb_out; j++)
+    {
+      conf.output_width = out_sizes[j].width;
+      conf.output_height = out_sizes[j].height;
+      ret = CMW_UTILS_SolvePipeConfig(cam_sizes[i].width, cam_sizes[i].height, &conf, &entry->conf);
+      if (ret != CMW_ERROR_NONE)
+      {
+        return ret;
+      }
+      entry->cam_width = cam_sizes[i].width;
+      entry->cam_height = cam_sizes[i].height;
+      entry->output_width = out_sizes[j].width;
+      entry->output_height = out_sizes[j].height;
+      entry++;
+    }
+  }
+  cache->nb_entries = nb_cam * nb_out;
+
+  return CMW_ERROR_NONE;
+}
+
+const CMW_PipeConfig_t *CMW_UTILS_PipeConfigCache_Get(const CMW_UTILS_PipeConfigCache_t *cache,
+                                                            uint32_t cam_width, uint32_t cam_height,
+                                                            uint32_t output_width, uint32_t output_height)
+{
+  const CMW_UTILS_PipeConfigEntry_t *entry;
+  uint32_t i;
+
+  for (i = 0; i < cache->nb_entries; i++)
+  {
+    entry = &cache->entries[i];
+    if ((entry->cam_width == cam_width) && (entry->cam_height == cam_height) &&
+        (entry->output_width == output_width) && (entry->output_height == output_height))
+    {
+      return &entry->conf;
+    }
+  }
+
+  return NULL;
+}
+
 static void CMW_UTILS_get_crop_config(uint32_t cam_width, uint32_t cam_height, uint32_t pipe_width, uint32_t pipe_height, DCMIPP_CropConfTypeDef *crop)
 {
   const float ratio_width = (float)cam_width / pipe_width ;
@@ -161,3 +324,34 @@ static void CMW_UTILS_get_downsize_config_from_manual(CMW_Manual_Configuration_t
 
   CMW_UTILS_get_down_config(ratiox, ratioy, conf->downsize.width, conf->downsize.height, down);
 }
+
+static int32_t CMW_UTILS_solve_axis(uint32_t num, uint32_t den, int is_vertical, uint32_t *dec_ratio,
+                                    uint32_t *down_ratio, uint32_t *down_div)
+{
+  uint32_t dec = CMW_UTILS_DEC_RATIO_MAX;
+  uint64_t ratio;
+
+  /* No upscale */
+  if ((den == 0) || (num < den))
+  {
+    return CMW_ERROR_WRONG_PARAM;
+  }
+
+  /* Decimate first: it drops pixels before they reach the downsize engine */
+  while ((uint64_t)dec * den > num)
+  {
+    dec /= 2;
+  }
+
+  ratio = ((uint64_t)CMW_UTILS_DOWN_RATIO_ONE * num) / ((uint64_t)dec * den);
+  if (ratio > CMW_UTILS_DOWN_RATIO_MAX)
+  {
+    return CMW_ERROR_WRONG_PARAM;
+  }
+
+  *dec_ratio = CMW_UTILS_get_dec_ratio_from_decimal_ratio(dec, is_vertical);
+  *down_ratio = (uint32_t)ratio;
+  *down_div = (1024 * 8192 - 1) / *down_ratio;
+
+  return CMW_ERROR_NONE;
+}
@@ -22,10 +22,39 @@
 #include "stm32n6xx_hal_dcmipp.h"
 #include "cmw_camera.h"
 
+typedef struct {
+  uint32_t width;
+  uint32_t height;
+} CMW_UTILS_Size_t;
 
+typedef struct {
+  uint32_t cam_width;
+  uint32_t cam_height;
+  uint32_t output_width;
+  uint32_t output_height;
+  CMW_PipeConfig_t conf;
+} CMW_UTILS_PipeConfigEntry_t;
+
+/* Precomputed pipe configurations for all (sensor mode, pipe output size) pairs */
+typedef struct {
+  CMW_UTILS_PipeConfigEntry_t *entries;
+  uint32_t nb_entries;
+} CMW_UTILS_PipeConfigCache_t;
 
 void CMW_UTILS_GetPipeConfig(uint32_t cam_width, uint32_t cam_height, DCMIPP_Conf_t *p_conf,
                                     DCMIPP_CropConfTypeDef *crop, DCMIPP_DecimationConfTypeDef *dec,
                                     DCMIPP_DownsizeTypeDef *down);
 
+int32_t CMW_UTILS_SolvePipeConfig(uint32_t cam_width, uint32_t cam_height, const DCMIPP_Conf_t *p_conf,
+                                  CMW_PipeConfig_t *conf);
+
+int32_t CMW_UTILS_PipeConfigCache_Build(CMW_UTILS_PipeConfigCache_t *cache, CMW_UTILS_PipeConfigEntry_t *entries,
+                                        uint32_t max_entries, const CMW_UTILS_Size_t *cam_sizes, uint32_t nb_cam,
+                                        const CMW_UTILS_Size_t *out_sizes, uint32_t nb_out,
+                                        const DCMIPP_Conf_t *p_conf);
+
+const CMW_PipeConfig_t *CMW_UTILS_PipeConfigCache_Get(const CMW_UTILS_PipeConfigCache_t *cache,
+                                                            uint32_t cam_width, uint32_t cam_height,
+                                                            uint32_t output_width, uint32_t output_height);
+
 #endif
\ No newline at end of file
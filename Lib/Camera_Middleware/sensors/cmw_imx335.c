@@ -140,6 +140,17 @@ static int32_t CMW_IMX335_SetTestPattern(void *io_ctx, int32_t mode)
   return IMX335_SetTestPattern(&((CMW_IMX335_t *)io_ctx)->ctx_driver, mode);
 }
 
+static int32_t CMW_IMX335_SetMeteringROI(void *io_ctx, ISP_MeteringTypeDef *metering)
+{
+  int ret;
+  ret = ISP_SetMeteringROI(&((CMW_IMX335_t *)io_ctx)->hIsp, metering);
+  if (ret != ISP_OK)
+  {
+    return CMW_ERROR_WRONG_PARAM;
+  }
+  return CMW_ERROR_NONE;
+}
+
 static int32_t CMW_IMX335_Init(void *io_ctx, CMW_Sensor_Init_t *initSensor)
 {
   int ret = CMW_ERROR_NONE;
@@ -280,5 +291,6 @@ int CMW_IMX335_Probe(CMW_IMX335_t *io_ctx, CMW_Sensor_if_t *imx335_if)
   imx335_if->SetMirrorFlip = CMW_IMX335_SetMirrorFlip;
   imx335_if->GetSensorInfo = CMW_IMX335_GetSensorInfo;
   imx335_if->SetTestPattern = CMW_IMX335_SetTestPattern;
+  imx335_if->SetMeteringROI = CMW_IMX335_SetMeteringROI;
   return ret;
 }
@@ -63,6 +63,7 @@ typedef struct
   int32_t (*SetFlickerMode)(void *, int32_t);
   int32_t (*GetSensorInfo)(void *, ISP_SensorInfoTypeDef *);
   int32_t (*SetTestPattern)(void *, int32_t);
+  int32_t (*SetMeteringROI)(void *, ISP_MeteringTypeDef *);
 } CMW_Sensor_if_t;
 
 #ifdef __cplusplus
@@ -299,6 +299,17 @@ static int32_t CMW_VD66GY_Start(void *io_ctx)
   return CMW_ERROR_NONE;
 }
 
+static int32_t CMW_VD66GY_SetMeteringROI(void *io_ctx, ISP_MeteringTypeDef *metering)
+{
+  int ret;
+  ret = ISP_SetMeteringROI(&((CMW_VD66GY_t *)io_ctx)->hIsp, metering);
+  if (ret != ISP_OK)
+  {
+    return CMW_ERROR_WRONG_PARAM;
+  }
+  return CMW_ERROR_NONE;
+}
+
 static int32_t CMW_VD66GY_Run(void *io_ctx)
 {
   int ret;
@@ -595,5 +606,6 @@ int CMW_VD66GY_Probe(CMW_VD66GY_t *io_ctx, CMW_Sensor_if_t *vd6g_if)
   vd6g_if->SetExposure = CMW_VD66GY_SetExposure;
   vd6g_if->SetExposureMode = CMW_VD66GY_SetExposureMode;
   vd6g_if->GetSensorInfo = CMW_VD66GY_GetSensorInfo;
+  vd6g_if->SetMeteringROI = CMW_VD66GY_SetMeteringROI;
   return ret;
 }
@@ -0,0 +1,212 @@
+ /**
+ ******************************************************************************
+ * @file    pipe_config_check.c
+ * @author  GPM Application Team
+ * @brief   Host check of the CMW_UTILS pipe configuration solver and cache.
+ *          Solves every (sensor mode, model input size, aspect ratio mode)
+ *          combination, checks the hardware limits of each stage and prints
+ *          one line per combination, compared against pipe_config_golden.txt.
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2024 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "cmw_utils.h"
+
+#include <stdio.h>
+
+#define ARRAY_NB(a) (sizeof(a) / sizeof((a)[0]))
+
+/* Sensor modes of the supported sensors (see Inc/app_config.h) */
+static const CMW_UTILS_Size_t cam_sizes[] = {
+  { 2592, 1944 }, /* IMX335 */
+  { 2560, 1984 }, /* VD1941 */
+  { 1120, 720 },  /* VD66GY */
+  { 800, 600 },   /* VD55G1 */
+  { 800, 480 },   /* OV5640 */
+};
+
+/* Model input sizes */
+static const CMW_UTILS_Size_t out_sizes[] = {
+  { 128, 128 },
+  { 192, 192 },
+  { 224, 224 },
+  { 256, 256 },
+  { 320, 320 },
+  { 416, 416 },
+  { 480, 480 },
+  { 640, 480 },
+};
+
+static const struct {
+  int mode;
+  const char *name;
+} modes[] = {
+  { CAM_Aspect_ratio_crop, "crop" },
+  { CAM_Aspect_ratio_fit, "fit" },
+  { CAM_Aspect_ratio_fullscreen, "fullscreen" },
+};
+
+static CMW_UTILS_PipeConfigEntry_t entries[ARRAY_NB(cam_sizes) * ARRAY_NB(out_sizes)];
+
+static uint32_t dec_factor(uint32_t reg, int is_vertical)
+{
+  if (reg == (is_vertical ? DCMIPP_VDEC_1_OUT_2 : DCMIPP_HDEC_1_OUT_2))
+    return 2;
+  if (reg == (is_vertical ? DCMIPP_VDEC_1_OUT_4 : DCMIPP_HDEC_1_OUT_4))
+    return 4;
+  if (reg == (is_vertical ? DCMIPP_VDEC_1_OUT_8 : DCMIPP_HDEC_1_OUT_8))
+    return 8;
+
+  return 1;
+}
+
+/* Pixels entering the downsize engine per frame */
+static uint32_t down_input(uint32_t h_in, uint32_t v_in, const DCMIPP_DecimationConfTypeDef *dec)
+{
+  return (h_in / dec_factor(dec->HRatio, 0)) * (v_in / dec_factor(dec->VRatio, 1));
+}
+
+static int check(const CMW_UTILS_Size_t *cam, const CMW_UTILS_Size_t *out, const CMW_PipeConfig_t *conf)
+{
+  const DCMIPP_DownsizeTypeDef *down = &conf->down;
+  int err = 0;
+
+  if (conf->crop.HSize != 0)
+  {
+    err |= conf->crop.HStart + conf->crop.HSize > cam->width;
+    err |= conf->crop.VStart + conf->crop.VSize > cam->height;
+    /* Same aspect ratio as the output, to one pixel */
+    err |= (uint64_t)conf->crop.HSize * out->height > (uint64_t)(conf->crop.VSize + 1) * out->width;
+    err |= (uint64_t)conf->crop.VSize * out->width > (uint64_t)(conf->crop.HSize + 1) * out->height;
+  }
+  err |= down->HRatio < 8192 || down->HRatio > 65535;
+  err |= down->VRatio < 8192 || down->VRatio > 65535;
+  err |= down->HSize != out->width || down->VSize != out->height;
+  err |= down->HDivFactor != (1024 * 8192 - 1) / down->HRatio;
+  err |= down->VDivFactor != (1024 * 8192 - 1) / down->VRatio;
+  err |= conf->pitch != out->width * 2;
+
+  return err;
+}
+
+int main(void)
+{
+  CMW_UTILS_PipeConfigCache_t cache;
+  uint64_t bw_legacy = 0;
+  uint64_t bw = 0;
+  DCMIPP_Conf_t dcmipp_conf = { 0 };
+  int failed = 0;
+  uint32_t m, i, j;
+  int32_t ret;
+
+  dcmipp_conf.output_format = DCMIPP_PIXEL_PACKER_FORMAT_RGB565_1;
+  dcmipp_conf.output_bpp = 2;
+
+  for (m = 0; m < ARRAY_NB(modes); m++)
+  {
+    dcmipp_conf.mode = modes[m].mode;
+    ret = CMW_UTILS_PipeConfigCache_Build(&cache, entries, ARRAY_NB(entries), cam_sizes, ARRAY_NB(cam_sizes),
+                                          out_sizes, ARRAY_NB(out_sizes), &dcmipp_conf);
+    if (ret != CMW_ERROR_NONE)
+    {
+      printf("%s: cache build failed %d\n", modes[m].name, (int)ret);
+      failed = 1;
+      continue;
+    }
+
+    for (i = 0; i < ARRAY_NB(cam_sizes); i++)
+    {
+      for (j = 0; j < ARRAY_NB(out_sizes); j++)
+      {
+        const CMW_UTILS_Size_t *cam = &cam_sizes[i];
+        const CMW_UTILS_Size_t *out = &out_sizes[j];
+        DCMIPP_DecimationConfTypeDef dec_legacy = { 0 };
+        DCMIPP_DownsizeTypeDef down_legacy = { 0 };
+        DCMIPP_CropConfTypeDef crop_legacy = { 0 };
+        const CMW_PipeConfig_t *conf;
+        uint32_t h_in, v_in;
+
+        conf = CMW_UTILS_PipeConfigCache_Get(&cache, cam->width, cam->height, out->width, out->height);
+        if (conf == NULL)
+        {
+          printf("%s %ux%u -> %ux%u: missing from cache\n", modes[m].name, cam->width, cam->height,
+                 out->width, out->height);
+          failed = 1;
+          continue;
+        }
+
+        if (modes[m].mode == CAM_Aspect_ratio_crop)
+        {
+          h_in = conf->crop.HSize;
+          v_in = conf->crop.VSize;
+        }
+        else if (modes[m].mode == CAM_Aspect_ratio_fit)
+        {
+          h_in = cam->width;
+          v_in = cam->height;
+        }
+        else
+        {
+          /* Downsize output window spans out_width * ratio sensor columns */
+          h_in = (uint32_t)(((uint64_t)out->width * cam->height) / out->height);
+          v_in = cam->height;
+        }
+
+        dcmipp_conf.output_width = out->width;
+        dcmipp_conf.output_height = out->height;
+        CMW_UTILS_GetPipeConfig(cam->width, cam->height, &dcmipp_conf, &crop_legacy, &dec_legacy, &down_legacy);
+        bw_legacy += down_input(h_in, v_in, &dec_legacy);
+        bw += down_input(h_in, v_in, &conf->dec);
+
+        if (check(cam, out, conf))
+        {
+          printf("FAIL ");
+          failed = 1;
+        }
+        printf("%-10s %4ux%-4u -> %3ux%-3u crop %4u,%-4u %4ux%-4u dec %ux%u down %5u/%5u div %4u/%4u pitch %4u\n",
+               modes[m].name, cam->width, cam->height, out->width, out->height,
+               conf->crop.HStart, conf->crop.VStart, conf->crop.HSize, conf->crop.VSize,
+               dec_factor(conf->dec.HRatio, 0), dec_factor(conf->dec.VRatio, 1),
+               conf->down.HRatio, conf->down.VRatio, conf->down.HDivFactor, conf->down.VDivFactor,
+               conf->pitch);
+      }
+    }
+  }
+
+  /* Unreachable outputs are rejected */
+  dcmipp_conf.mode = CAM_Aspect_ratio_fit;
+  dcmipp_conf.output_width = 1024;
+  dcmipp_conf.output_height = 768;
+  if (CMW_UTILS_SolvePipeConfig(800, 600, &dcmipp_conf, &entries[0].conf) != CMW_ERROR_WRONG_PARAM)
+  {
+    printf("FAIL upscale accepted\n");
+    failed = 1;
+  }
+  dcmipp_conf.output_width = 32;
+  dcmipp_conf.output_height = 24;
+  if (CMW_UTILS_SolvePipeConfig(2592, 1944, &dcmipp_conf, &entries[0].conf) != CMW_ERROR_WRONG_PARAM)
+  {
+    printf("FAIL ratio above 64 accepted\n");
+    failed = 1;
+  }
+  if (CMW_UTILS_PipeConfigCache_Build(&cache, entries, 1, cam_sizes, 1, out_sizes, 2, &dcmipp_conf) != CMW_ERROR_WRONG_PARAM)
+  {
+    printf("FAIL cache overflow accepted\n");
+    failed = 1;
+  }
+
+  printf("downsize input pixels: %llu (CMW_UTILS_GetPipeConfig %llu)\n", (unsigned long long)bw,
+         (unsigned long long)bw_legacy);
+
+  return failed;
+}
@@ -162,6 +162,7 @@ extern   "C" {
 #define TX_4_ULONG                      ((UINT)   4)
 #define TX_8_ULONG                      ((UINT)   8)
 #define TX_16_ULONG                     ((UINT)   16)
+#define TX_POINTER_ULONG                ((UINT)   ((sizeof(VOID *) + sizeof(ULONG) - 1) / sizeof(ULONG)))
 #define TX_NO_TIME_SLICE                ((ULONG)  0)
 #define TX_AUTO_START                   ((UINT)   1)
 #define TX_DONT_START                   ((UINT)   0)
@@ -623,6 +624,14 @@ typedef struct TX_THREAD_STRUCT
 #if (defined(TX_EXECUTION_PROFILE_ENABLE) && !defined(TX_ENABLE_EXECUTION_CHANGE_NOTIFY))
     EXECUTION_TIME              tx_thread_execution_time_total;
     EXECUTION_TIME_SOURCE_TYPE  tx_thread_execution_time_last_start;
+#ifdef TX_EXECUTION_PROFILE_ENABLE_HISTOGRAMS
+
+    /* Define the histogram record of the thread and the start times of its ready and
+       running periods.  */
+    struct TX_EXECUTION_THREAD_PROFILE_STRUCT *tx_thread_execution_profile_ptr;
+    EXECUTION_TIME_SOURCE_TYPE  tx_thread_execution_ready_start;
+    EXECUTION_TIME_SOURCE_TYPE  tx_thread_execution_slice_start;
+#endif
 #endif
 
     /* Define suspension sequence number.  This is used to ensure suspension is still valid when
@@ -635,6 +644,23 @@ typedef struct TX_THREAD_STRUCT
     ULONG               tx_thread_stack_fill_value;
 #endif
 
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+
+    /* Define the block cache of the thread: the block pool the cached blocks
+       belong to, the list of cached blocks and the number of cached blocks.  */
+    struct TX_BLOCK_POOL_STRUCT
+                        *tx_thread_block_cache_pool;
+    UCHAR               *tx_thread_block_cache_list;
+    UINT                tx_thread_block_cache_count;
+
+#ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
+
+    /* Define the number of block allocates and releases served by the cache.  */
+    ULONG               tx_thread_block_cache_allocate_count;
+    ULONG               tx_thread_block_cache_release_count;
+#endif
+#endif
+
     /* Define the user extension field.  This typically is defined
        to white space, but some ports of ThreadX may need to have
        additional fields in the thread control block.  This is
@@ -697,6 +723,14 @@ typedef struct TX_BLOCK_POOL_STRUCT
 
     /* Define the number of block pool timeouts.  */
     ULONG               tx_block_pool_performance_timeout_count;
+
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+
+    /* Define the number of block allocates and releases served by the cache
+       of threads no longer bound to this block pool.  */
+    ULONG               tx_block_pool_performance_cache_allocate_count;
+    ULONG               tx_block_pool_performance_cache_release_count;
+#endif
 #endif
 
     /* Define the port extension in the block pool control block. This
@@ -722,6 +756,26 @@ typedef struct TX_BLOCK_POOL_STRUCT
 #endif
 
 
+/* Define the size of the segregated free list index used by the byte pools when
+   TX_BYTE_POOL_ENABLE_TLSF is defined. Free blocks are indexed by first level classes
+   (powers of two) split in TX_BYTE_POOL_TLSF_SL_COUNT second level ranges. Blocks
+   larger than 2^(TX_BYTE_POOL_TLSF_FL_MAX + 1) - 1 bytes all share the last list,
+   which is searched linearly, so TX_BYTE_POOL_TLSF_FL_MAX should cover the largest
+   byte pool of the application to keep the allocation time bounded.  */
+
+#ifdef TX_BYTE_POOL_ENABLE_TLSF
+#ifndef TX_BYTE_POOL_TLSF_SL_SHIFT
+#define TX_BYTE_POOL_TLSF_SL_SHIFT      3
+#endif
+#ifndef TX_BYTE_POOL_TLSF_FL_MAX
+#define TX_BYTE_POOL_TLSF_FL_MAX        24
+#endif
+#define TX_BYTE_POOL_TLSF_SL_COUNT      (1 << TX_BYTE_POOL_TLSF_SL_SHIFT)
+#define TX_BYTE_POOL_TLSF_FL_SHIFT      (TX_BYTE_POOL_TLSF_SL_SHIFT + 2)
+#define TX_BYTE_POOL_TLSF_FL_COUNT      (TX_BYTE_POOL_TLSF_FL_MAX - TX_BYTE_POOL_TLSF_FL_SHIFT + 2)
+#endif
+
+
 /* Define the byte memory pool structure utilized by the application.  */
 
 typedef struct TX_BYTE_POOL_STRUCT
@@ -794,6 +848,15 @@ typedef struct TX_BYTE_POOL_STRUCT
     ULONG               tx_byte_pool_performance_timeout_count;
 #endif
 
+#ifdef TX_BYTE_POOL_ENABLE_TLSF
+
+    /* Define the segregated free list index: one bit per non-empty first level class,
+       one bit per non-empty second level list, and the free list heads.  */
+    ULONG               tx_byte_pool_tlsf_fl_bitmap;
+    ULONG               tx_byte_pool_tlsf_sl_bitmap[TX_BYTE_POOL_TLSF_FL_COUNT];
+    UCHAR               *tx_byte_pool_tlsf_free_list[TX_BYTE_POOL_TLSF_FL_COUNT][TX_BYTE_POOL_TLSF_SL_COUNT];
+#endif
+
     /* Define the port extension in the byte pool control block. This
        is typically defined to whitespace in tx_port.h.  */
     TX_BYTE_POOL_EXTENSION
@@ -1173,6 +1236,8 @@ UINT    _tx_trace_interrupt_control(UINT new_posture);
 #define tx_queue_send_notify                        _tx_queue_send_notify
 #define tx_queue_front_send                         _tx_queue_front_send
 #define tx_queue_prioritize                         _tx_queue_prioritize
+#define tx_queue_pointer_receive                    _tx_queue_pointer_receive
+#define tx_queue_pointer_send                       _tx_queue_pointer_send
 
 #define tx_semaphore_ceiling_put                    _tx_semaphore_ceiling_put
 #define tx_semaphore_create                         _tx_semaphore_create
@@ -1296,6 +1361,8 @@ UINT    _tx_trace_interrupt_control(UINT new_posture);
 #define tx_queue_send_notify                        _txr_queue_send_notify
 #define tx_queue_front_send                         _txr_queue_front_send
 #define tx_queue_prioritize                         _txr_queue_prioritize
+#define tx_queue_pointer_receive                    _txe_queue_pointer_receive
+#define tx_queue_pointer_send                       _txe_queue_pointer_send
 
 #define tx_semaphore_ceiling_put                    _txr_semaphore_ceiling_put
 #define tx_semaphore_create(s,n,i)                  _txr_semaphore_create((s),(n),(i),(sizeof(TX_SEMAPHORE)))
@@ -1407,6 +1474,8 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_queue_send_notify                        _txe_queue_send_notify
 #define tx_queue_front_send                         _txe_queue_front_send
 #define tx_queue_prioritize                         _txe_queue_prioritize
+#define tx_queue_pointer_receive                    _txe_queue_pointer_receive
+#define tx_queue_pointer_send                       _txe_queue_pointer_send
 
 #define tx_semaphore_ceiling_put                    _txe_semaphore_ceiling_put
 #define tx_semaphore_create(s,n,i)                  _txe_semaphore_create((s),(n),(i),(sizeof(TX_SEMAPHORE)))
@@ -1665,6 +1734,10 @@ UINT        _tx_queue_receive(TX_QUEUE *queue_ptr, VOID *destination_ptr, ULONG
 UINT        _tx_queue_send(TX_QUEUE *queue_ptr, VOID *source_ptr, ULONG wait_option);
 UINT        _tx_queue_send_notify(TX_QUEUE *queue_ptr, VOID (*queue_send_notify)(TX_QUEUE *notify_queue_ptr));
 UINT        _tx_queue_front_send(TX_QUEUE *queue_ptr, VOID *source_ptr, ULONG wait_option);
+UINT        _tx_queue_pointer_receive(TX_QUEUE *queue_ptr, VOID **pointer_array, UINT count, UINT *actual_count,
+                    ULONG wait_option);
+UINT        _tx_queue_pointer_send(TX_QUEUE *queue_ptr, VOID **pointer_array, UINT count, UINT *actual_count,
+                    ULONG wait_option);
 
 
 /* Define error checking shells for API services.  These are only referenced by the
@@ -1681,6 +1754,10 @@ UINT        _txe_queue_receive(TX_QUEUE *queue_ptr, VOID *destination_ptr, ULONG
 UINT        _txe_queue_send(TX_QUEUE *queue_ptr, VOID *source_ptr, ULONG wait_option);
 UINT        _txe_queue_send_notify(TX_QUEUE *queue_ptr, VOID (*queue_send_notify)(TX_QUEUE *notify_queue_ptr));
 UINT        _txe_queue_front_send(TX_QUEUE *queue_ptr, VOID *source_ptr, ULONG wait_option);
+UINT        _txe_queue_pointer_receive(TX_QUEUE *queue_ptr, VOID **pointer_array, UINT count, UINT *actual_count,
+                    ULONG wait_option);
+UINT        _txe_queue_pointer_send(TX_QUEUE *queue_ptr, VOID **pointer_array, UINT count, UINT *actual_count,
+                    ULONG wait_option);
 #ifdef TX_ENABLE_MULTI_ERROR_CHECKING
 UINT        _txr_queue_create(TX_QUEUE *queue_ptr, CHAR *name_ptr, UINT message_size,
                         VOID *queue_start, ULONG queue_size, UINT queue_control_block_size);
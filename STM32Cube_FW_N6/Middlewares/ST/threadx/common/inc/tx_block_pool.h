@@ -56,6 +56,22 @@
 #define TX_BLOCK_POOL_ID                        ((ULONG) 0x424C4F43)
 
 
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+
+/* Define the maximum number of blocks held in the cache of a thread, and the maximum
+   number of blocks moved from the pool to an empty cache in one interrupt lockout. A
+   refill never takes more than half of the available blocks of the pool.  */
+
+#ifndef TX_BLOCK_POOL_THREAD_CACHE_SIZE
+#define TX_BLOCK_POOL_THREAD_CACHE_SIZE         ((UINT) 8)
+#endif
+
+#ifndef TX_BLOCK_POOL_THREAD_CACHE_REFILL
+#define TX_BLOCK_POOL_THREAD_CACHE_REFILL       ((UINT) 4)
+#endif
+#endif
+
+
 /* Determine if in-line component initialization is supported by the
    caller.  */
 
@@ -68,7 +84,7 @@
 #define _tx_block_pool_initialize() \
                     _tx_block_pool_created_ptr =                   TX_NULL;     \
                     _tx_block_pool_created_count =                 TX_EMPTY
-#else
+#elif !defined(TX_BLOCK_POOL_ENABLE_THREAD_CACHE)
 #define _tx_block_pool_initialize() \
                     _tx_block_pool_created_ptr =                   TX_NULL;     \
                     _tx_block_pool_created_count =                 TX_EMPTY;    \
@@ -76,6 +92,16 @@
                     _tx_block_pool_performance_release_count =     ((ULONG) 0); \
                     _tx_block_pool_performance_suspension_count =  ((ULONG) 0); \
                     _tx_block_pool_performance_timeout_count =     ((ULONG) 0)
+#else
+#define _tx_block_pool_initialize() \
+                    _tx_block_pool_created_ptr =                   TX_NULL;     \
+                    _tx_block_pool_created_count =                 TX_EMPTY;    \
+                    _tx_block_pool_performance_allocate_count =    ((ULONG) 0); \
+                    _tx_block_pool_performance_release_count =     ((ULONG) 0); \
+                    _tx_block_pool_performance_suspension_count =  ((ULONG) 0); \
+                    _tx_block_pool_performance_timeout_count =     ((ULONG) 0); \
+                    _tx_block_pool_performance_cache_allocate_count =  ((ULONG) 0); \
+                    _tx_block_pool_performance_cache_release_count =   ((ULONG) 0)
 #endif
 #define TX_BLOCK_POOL_INIT
 #else
@@ -88,6 +114,11 @@ VOID        _tx_block_pool_initialize(VOID);
 /* Define internal block memory pool management function prototypes.  */
 
 VOID        _tx_block_pool_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+UINT        _tx_block_pool_thread_cache_allocate(TX_BLOCK_POOL *pool_ptr, VOID **block_ptr);
+UINT        _tx_block_pool_thread_cache_release(VOID *block_ptr);
+VOID        _tx_block_pool_thread_cache_flush(TX_THREAD *thread_ptr);
+#endif
 
 
 /* Block pool management component data declarations follow.  */
@@ -135,6 +166,16 @@ BLOCK_POOL_DECLARE  ULONG                  _tx_block_pool_performance_suspension
 BLOCK_POOL_DECLARE  ULONG                  _tx_block_pool_performance_timeout_count;
 
 
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+
+/* Define the total number of block allocates and releases served by the cache of
+   threads that were deleted or moved their cache to another pool. The counts of the
+   current thread caches are added when the performance information is retrieved.  */
+
+BLOCK_POOL_DECLARE  ULONG                  _tx_block_pool_performance_cache_allocate_count;
+BLOCK_POOL_DECLARE  ULONG                  _tx_block_pool_performance_cache_release_count;
+#endif
+
 #endif
 
 
@@ -68,6 +68,55 @@
 #endif
 
 
+#ifdef TX_BYTE_POOL_ENABLE_TLSF
+
+/* Define the segregated fit byte pool definitions. Blocks keep the standard header: the
+   pointer to the next physical block followed by either TX_BYTE_BLOCK_FREE or the owning
+   pool pointer. A free block also holds its free list next and previous pointers right
+   after the header and a pointer to its own header in its last word. No two free blocks
+   are adjacent, and the owner field of the allocated block following a free block has
+   TX_BYTE_POOL_TLSF_PREVIOUS_FREE set, so that a release finds both free neighbors in
+   constant time.  */
+
+#define TX_BYTE_POOL_TLSF_OVERHEAD              ((ULONG) ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))))
+#define TX_BYTE_POOL_TLSF_PREVIOUS_FREE         ((ALIGN_TYPE) 1)
+#define TX_BYTE_POOL_TLSF_FREE_BLOCK_MIN        (TX_BYTE_POOL_TLSF_OVERHEAD + ((ULONG) (3 * (sizeof(UCHAR *)))))
+#define TX_BYTE_POOL_TLSF_BLOCK_MIN             ((TX_BYTE_POOL_TLSF_FREE_BLOCK_MIN > TX_BYTE_BLOCK_MIN) ? \
+                                                    TX_BYTE_POOL_TLSF_FREE_BLOCK_MIN : TX_BYTE_BLOCK_MIN)
+
+
+/* Define the highest bit set macro used to compute the first level class of a block
+   size. Note, that this may be overridden by a port specific definition if there is
+   a count leading zeros instruction in the architecture.  */
+
+#ifndef TX_BYTE_POOL_TLSF_HIGHEST_SET_BIT_CALCULATE
+#define TX_BYTE_POOL_TLSF_HIGHEST_SET_BIT_CALCULATE(m, b)   \
+    (b) =  ((ULONG) 0);                                     \
+    if ((m) >= ((ULONG) 0x10000))                           \
+    {                                                       \
+        (m) = (m) >> ((ULONG) 16);                          \
+        (b) = (b) + ((ULONG) 16);                           \
+    }                                                       \
+    if ((m) >= ((ULONG) 0x100))                             \
+    {                                                       \
+        (m) = (m) >> ((ULONG) 8);                           \
+        (b) = (b) + ((ULONG) 8);                            \
+    }                                                       \
+    if ((m) >= ((ULONG) 0x10))                              \
+    {                                                       \
+        (m) = (m) >> ((ULONG) 4);                           \
+        (b) = (b) + ((ULONG) 4);                            \
+    }                                                       \
+    if ((m) >= ((ULONG) 4))                                 \
+    {                                                       \
+        (m) = (m) >> ((ULONG) 2);                           \
+        (b) = (b) + ((ULONG) 2);                            \
+    }                                                       \
+    (b) = (b) + ((m) >> ((ULONG) 1));
+#endif
+#endif
+
+
 /* Determine if in-line component initialization is supported by the
    caller.  */
 
@@ -104,6 +153,12 @@ VOID        _tx_byte_pool_initialize(VOID);
 
 UCHAR       *_tx_byte_pool_search(TX_BYTE_POOL *pool_ptr, ULONG memory_size);
 VOID        _tx_byte_pool_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
+#ifdef TX_BYTE_POOL_ENABLE_TLSF
+VOID        _tx_byte_pool_tlsf_mapping(ULONG block_size, UINT *first_level, UINT *second_level);
+VOID        _tx_byte_pool_tlsf_insert(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr);
+VOID        _tx_byte_pool_tlsf_remove(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr);
+VOID        _tx_byte_pool_tlsf_free(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr);
+#endif
 
 
 /* Byte pool management component data declarations follow.  */
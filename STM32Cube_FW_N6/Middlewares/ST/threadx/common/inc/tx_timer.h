@@ -57,6 +57,35 @@
 #define TX_TIMER_ENTRIES                        ((ULONG) 32)
 
 
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+
+/* Define the hierarchical timing wheel definitions. Timers that do not fit in the timer
+   list are placed on one of TX_TIMER_WHEEL_LEVELS levels of TX_TIMER_ENTRIES slots, each
+   slot of a level covering a full turn of the level below. An internal timer expires on
+   the timer list every TX_TIMER_ENTRIES ticks while the wheel is not empty, and moves the
+   timers of the slots that are due one level down, or to the timer list. The remaining
+   ticks of a timer on the wheel hold its absolute expiration time. The default three
+   levels cover 32^4 ticks, longer timers stay on the last level until they get in range.  */
+
+#ifndef TX_TIMER_WHEEL_LEVELS
+#define TX_TIMER_WHEEL_LEVELS                   3
+#endif
+
+#if (TX_TIMER_WHEEL_LEVELS < 1) || (TX_TIMER_WHEEL_LEVELS > 5)
+#error "TX_TIMER_WHEEL_LEVELS must be between 1 and 5"
+#endif
+
+#ifdef TX_REACTIVATE_INLINE
+#error "TX_REACTIVATE_INLINE is not supported with TX_TIMER_ENABLE_HIERARCHICAL_WHEEL"
+#endif
+
+/* Define the number of bits of a slot index, TX_TIMER_ENTRIES being 2^TX_TIMER_WHEEL_SHIFT.  */
+
+#define TX_TIMER_WHEEL_SHIFT                    ((UINT) 5)
+#define TX_TIMER_WHEEL_SLOTS                    (((ULONG) TX_TIMER_WHEEL_LEVELS) * TX_TIMER_ENTRIES)
+#endif
+
+
 /* Define internal timer management function prototypes.  */
 
 VOID        _tx_timer_expiration_process(VOID);
@@ -64,6 +93,12 @@ VOID        _tx_timer_initialize(VOID);
 VOID        _tx_timer_system_activate(TX_TIMER_INTERNAL *timer_ptr);
 VOID        _tx_timer_system_deactivate(TX_TIMER_INTERNAL *timer_ptr);
 VOID        _tx_timer_thread_entry(ULONG timer_thread_input);
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+ULONG       _tx_timer_wheel_boundary_get(VOID);
+VOID        _tx_timer_wheel_cascade(ULONG timer_input);
+VOID        _tx_timer_wheel_insert(TX_TIMER_INTERNAL *timer_ptr);
+UINT        _tx_timer_wheel_next_get(ULONG *next_ticks_ptr);
+#endif
 
 
 /* Timer management component data declarations follow.  */
@@ -137,6 +172,26 @@ TIMER_DECLARE ULONG             _tx_timer_created_count;
 TIMER_DECLARE TX_TIMER_INTERNAL *_tx_timer_expired_timer_ptr;
 
 
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+
+/* Define the slots of the timing wheel levels, level after level.  */
+
+TIMER_DECLARE TX_TIMER_INTERNAL *_tx_timer_wheel[TX_TIMER_WHEEL_SLOTS];
+
+
+/* Define the internal timer that moves the timers down the wheel.  */
+
+TIMER_DECLARE TX_TIMER          _tx_timer_wheel_timer;
+
+
+/* Define the time of the next expiration of the wheel timer, a multiple of
+   TX_TIMER_ENTRIES in the time base of the wheel expiration times.  */
+
+TIMER_DECLARE ULONG             _tx_timer_wheel_time;
+
+#endif
+
+
 #ifndef TX_TIMER_PROCESS_IN_ISR
 
 /* Define the timer thread's control block.  */
@@ -253,6 +253,16 @@
 #define TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
 */
 
+/* Determine if each thread keeps a small cache of blocks of the last block pool it allocated from.
+   When the following is defined, most block allocates and releases of a thread are served by its
+   cache without disabling interrupts, the cache being refilled from and flushed to the pool a few
+   blocks at a time (see TX_BLOCK_POOL_THREAD_CACHE_SIZE and TX_BLOCK_POOL_THREAD_CACHE_REFILL).
+   Blocks held in thread caches are not counted as available in the pool.  */
+
+/*
+#define TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+*/
+
 /* Determine if byte pool performance gathering is required by the application. When the following is
    defined, ThreadX gathers various byte pool performance information. */
 
@@ -260,6 +270,15 @@
 #define TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
 */
 
+/* Determine if the byte pools use the segregated fit allocator. When the following is defined,
+   each byte pool keeps its free blocks in size class lists indexed by bitmaps, and allocation
+   and release run in constant time regardless of the pool fragmentation, instead of the first
+   fit search. This option is not available with TX_MISRA_ENABLE.  */
+
+/*
+#define TX_BYTE_POOL_ENABLE_TLSF
+*/
+
 /* Determine if event flags performance gathering is required by the application. When the following is
    defined, ThreadX gathers various event flags performance information. */
 
@@ -302,6 +321,15 @@
 #define TX_TIMER_ENABLE_PERFORMANCE_INFO
 */
 
+/* Determine if timers that do not fit in the timer list are kept on a hierarchical timing wheel.
+   When the following is defined, such timers are only moved when their slot of the wheel is due,
+   instead of being processed again every TX_TIMER_ENTRIES ticks until they expire (see
+   TX_TIMER_WHEEL_LEVELS). This option cannot be used with TX_REACTIVATE_INLINE.  */
+
+/*
+#define TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+*/
+
 /*  Override options for byte pool searches of multiple blocks. */
 
 /*
@@ -61,6 +61,8 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _tx_block_pool_thread_cache_allocate                                */
+/*                                      Allocate from the thread cache    */
 /*    _tx_thread_system_suspend         Suspend thread                    */
 /*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
 /*                                                                        */
@@ -102,6 +104,17 @@ ULONG                       lower_tbu;
 #endif
 
 
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+
+    /* Try the block cache of the current thread first.  */
+    if (_tx_block_pool_thread_cache_allocate(pool_ptr, block_ptr) == TX_SUCCESS)
+    {
+
+        /* Return successful completion status.  */
+        return(TX_SUCCESS);
+    }
+#endif
+
     /* Disable interrupts to get a block from the pool.  */
     TX_DISABLE
 
@@ -84,6 +84,9 @@ TX_THREAD       *next_thread;
 UINT            suspended_count;
 TX_BLOCK_POOL   *next_pool;
 TX_BLOCK_POOL   *previous_pool;
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+ULONG           thread_count;
+#endif
 
 
     /* Disable interrupts to remove the block pool from the created list.  */
@@ -132,6 +135,42 @@ TX_BLOCK_POOL   *previous_pool;
         }
     }
 
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+
+    /* Drop the thread block caches bound to this block pool, their blocks
+       disappear with the pool.  */
+    thread_ptr =    _tx_thread_created_ptr;
+    thread_count =  _tx_thread_created_count;
+    while (thread_count != ((ULONG) 0))
+    {
+
+        /* Determine if the cache of this thread is bound to the pool.  */
+        if (thread_ptr -> tx_thread_block_cache_pool == pool_ptr)
+        {
+
+#ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
+
+            /* Keep the counters of the cache in the totals.  */
+            _tx_block_pool_performance_cache_allocate_count =
+                            _tx_block_pool_performance_cache_allocate_count + thread_ptr -> tx_thread_block_cache_allocate_count;
+            _tx_block_pool_performance_cache_release_count =
+                            _tx_block_pool_performance_cache_release_count + thread_ptr -> tx_thread_block_cache_release_count;
+            thread_ptr -> tx_thread_block_cache_allocate_count =  ((ULONG) 0);
+            thread_ptr -> tx_thread_block_cache_release_count =   ((ULONG) 0);
+#endif
+
+            /* Unbind the cache.  */
+            thread_ptr -> tx_thread_block_cache_pool =   TX_NULL;
+            thread_ptr -> tx_thread_block_cache_list =   TX_NULL;
+            thread_ptr -> tx_thread_block_cache_count =  ((UINT) 0);
+        }
+
+        /* Move to the next thread.  */
+        thread_ptr =  thread_ptr -> tx_thread_created_next;
+        thread_count--;
+    }
+#endif
+
     /* Temporarily disable preemption.  */
     _tx_thread_preempt_disable++;
 
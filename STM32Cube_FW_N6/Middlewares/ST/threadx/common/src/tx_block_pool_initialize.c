@@ -64,6 +64,15 @@ ULONG            _tx_block_pool_performance_suspension_count;
 
 ULONG            _tx_block_pool_performance_timeout_count;
 
+
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+
+/* Define the total number of block allocates and releases served by the cache
+   of threads no longer bound to a block pool.  */
+
+ULONG            _tx_block_pool_performance_cache_allocate_count;
+ULONG            _tx_block_pool_performance_cache_release_count;
+#endif
 #endif
 
 
@@ -127,6 +136,10 @@ VOID  _tx_block_pool_initialize(VOID)
     _tx_block_pool_performance_release_count =     ((ULONG) 0);
     _tx_block_pool_performance_suspension_count =  ((ULONG) 0);
     _tx_block_pool_performance_timeout_count =     ((ULONG) 0);
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+    _tx_block_pool_performance_cache_allocate_count =  ((ULONG) 0);
+    _tx_block_pool_performance_cache_release_count =   ((ULONG) 0);
+#endif
 #endif
 #endif
 }
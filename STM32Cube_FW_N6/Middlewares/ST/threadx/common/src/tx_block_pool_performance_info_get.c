@@ -29,6 +29,9 @@
 #include "tx_block_pool.h"
 #ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
 #include "tx_trace.h"
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+#include "tx_thread.h"
+#endif
 #endif
 
 
@@ -47,6 +50,9 @@
 /*    This function retrieves performance information from the specified  */
 /*    block pool.                                                         */
 /*                                                                        */
+/*    With TX_BLOCK_POOL_ENABLE_THREAD_CACHE, the allocations and         */
+/*    releases include those served by the block caches of the threads.   */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    pool_ptr                          Pointer to block pool control blk */
@@ -88,6 +94,12 @@ UINT  _tx_block_pool_performance_info_get(TX_BLOCK_POOL *pool_ptr, ULONG *alloca
 
 TX_INTERRUPT_SAVE_AREA
 UINT                    status;
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+TX_THREAD               *thread_ptr;
+ULONG                   thread_count;
+ULONG                   cache_allocates;
+ULONG                   cache_releases;
+#endif
 
 
     /* Determine if this is a legal request.  */
@@ -117,6 +129,27 @@ UINT                    status;
         /* Log this kernel call.  */
         TX_EL_BLOCK_POOL_PERFORMANCE_INFO_GET_INSERT
 
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+
+        /* Sum the counters of the thread caches bound to this pool.  */
+        cache_allocates =  pool_ptr -> tx_block_pool_performance_cache_allocate_count;
+        cache_releases =   pool_ptr -> tx_block_pool_performance_cache_release_count;
+        thread_ptr =       _tx_thread_created_ptr;
+        thread_count =     _tx_thread_created_count;
+        while (thread_count != ((ULONG) 0))
+        {
+
+            if (thread_ptr -> tx_thread_block_cache_pool == pool_ptr)
+            {
+
+                cache_allocates =  cache_allocates + thread_ptr -> tx_thread_block_cache_allocate_count;
+                cache_releases =   cache_releases + thread_ptr -> tx_thread_block_cache_release_count;
+            }
+            thread_ptr =  thread_ptr -> tx_thread_created_next;
+            thread_count--;
+        }
+#endif
+
         /* Retrieve all the pertinent information and return it in the supplied
            destinations.  */
 
@@ -125,6 +158,9 @@ UINT                    status;
         {
 
             *allocates =  pool_ptr -> tx_block_pool_performance_allocate_count;
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+            *allocates =  *allocates + cache_allocates;
+#endif
         }
 
         /* Retrieve the number of blocks released to this block pool.  */
@@ -132,6 +168,9 @@ UINT                    status;
         {
 
             *releases =  pool_ptr -> tx_block_pool_performance_release_count;
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+            *releases =  *releases + cache_releases;
+#endif
         }
 
         /* Retrieve the number of thread suspensions on this block pool.  */
@@ -29,6 +29,9 @@
 #include "tx_block_pool.h"
 #ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
 #include "tx_trace.h"
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+#include "tx_thread.h"
+#endif
 #endif
 
 /**************************************************************************/
@@ -45,6 +48,9 @@
 /*                                                                        */
 /*    This function retrieves block pool performance information.         */
 /*                                                                        */
+/*    With TX_BLOCK_POOL_ENABLE_THREAD_CACHE, the allocations and         */
+/*    releases include those served by the block caches of the threads.   */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    allocates                         Destination for the total number  */
@@ -83,6 +89,12 @@ UINT  _tx_block_pool_performance_system_info_get(ULONG *allocates, ULONG *releas
 #ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
 
 TX_INTERRUPT_SAVE_AREA
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+TX_THREAD               *thread_ptr;
+ULONG                   thread_count;
+ULONG                   cache_allocates;
+ULONG                   cache_releases;
+#endif
 
 
     /* Disable interrupts.  */
@@ -94,6 +106,23 @@ TX_INTERRUPT_SAVE_AREA
     /* Log this kernel call.  */
     TX_EL_BLOCK_POOL_PERFORMANCE_SYSTEM_INFO_GET_INSERT
 
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+
+    /* Sum the counters of all the thread caches.  */
+    cache_allocates =  _tx_block_pool_performance_cache_allocate_count;
+    cache_releases =   _tx_block_pool_performance_cache_release_count;
+    thread_ptr =       _tx_thread_created_ptr;
+    thread_count =     _tx_thread_created_count;
+    while (thread_count != ((ULONG) 0))
+    {
+
+        cache_allocates =  cache_allocates + thread_ptr -> tx_thread_block_cache_allocate_count;
+        cache_releases =   cache_releases + thread_ptr -> tx_thread_block_cache_release_count;
+        thread_ptr =       thread_ptr -> tx_thread_created_next;
+        thread_count--;
+    }
+#endif
+
     /* Retrieve all the pertinent information and return it in the supplied
        destinations.  */
 
@@ -102,6 +131,9 @@ TX_INTERRUPT_SAVE_AREA
     {
 
         *allocates =  _tx_block_pool_performance_allocate_count;
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+        *allocates =  *allocates + cache_allocates;
+#endif
     }
 
     /* Retrieve the total number of blocks released.  */
@@ -109,6 +141,9 @@ TX_INTERRUPT_SAVE_AREA
     {
 
         *releases =  _tx_block_pool_performance_release_count;
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+        *releases =  *releases + cache_releases;
+#endif
     }
 
     /* Retrieve the total number of block pool thread suspensions.  */
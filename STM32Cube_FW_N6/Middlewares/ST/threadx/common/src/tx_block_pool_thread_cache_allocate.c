@@ -0,0 +1,206 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Pool                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_block_pool.h"
+
+
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_pool_thread_cache_allocate                PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function allocates a block from the block cache of the         */
+/*    current thread. The cache is only accessed by its thread, so a      */
+/*    cached block is taken without disabling interrupts. An empty cache  */
+/*    is refilled with up to TX_BLOCK_POOL_THREAD_CACHE_REFILL blocks,    */
+/*    but never more than half of the available blocks, in a single       */
+/*    interrupt lockout. A cache bound to another pool is flushed first.  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    block_ptr                         Pointer to place allocated block  */
+/*                                        pointer                         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            TX_SUCCESS if the block comes     */
+/*                                        from the cache, TX_NOT_DONE if  */
+/*                                        the pool must be used           */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_block_pool_thread_cache_flush Flush the thread block cache      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_block_allocate                Allocate a memory block           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_block_pool_thread_cache_allocate(TX_BLOCK_POOL *pool_ptr, VOID **block_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD           *thread_ptr;
+UCHAR               *work_ptr;
+UCHAR               *temp_ptr;
+UCHAR               **next_block_ptr;
+UCHAR               **link_ptr;
+UCHAR               **return_ptr;
+UINT                refill_count;
+UINT                available;
+
+
+    /* Pickup thread pointer.  */
+    TX_THREAD_GET_CURRENT(thread_ptr)
+
+    /* The cache is only used from thread context.  */
+    if ((thread_ptr == TX_NULL) || (TX_THREAD_GET_SYSTEM_STATE() != ((ULONG) 0)))
+    {
+
+        /* Use the pool.  */
+        return(TX_NOT_DONE);
+    }
+
+    /* Determine if the cache holds blocks of another pool.  */
+    if ((thread_ptr -> tx_thread_block_cache_pool != pool_ptr) && (thread_ptr -> tx_thread_block_cache_pool != TX_NULL))
+    {
+
+        /* Give the blocks back to their pool.  */
+        _tx_block_pool_thread_cache_flush(thread_ptr);
+    }
+
+    /* Determine if the cache is empty.  */
+    if (thread_ptr -> tx_thread_block_cache_list == TX_NULL)
+    {
+
+        /* Disable interrupts to refill the cache from the pool.  */
+        TX_DISABLE
+
+        /* Leave a share of the available blocks to the other threads.  */
+        available =     pool_ptr -> tx_block_pool_available;
+        refill_count =  available / ((UINT) 2);
+        if (refill_count > TX_BLOCK_POOL_THREAD_CACHE_REFILL)
+        {
+
+            refill_count =  TX_BLOCK_POOL_THREAD_CACHE_REFILL;
+        }
+        else if (refill_count == ((UINT) 0))
+        {
+
+            /* Take the last block, if any.  */
+            refill_count =  available;
+        }
+        else
+        {
+
+            /* Refill count is fine.  */
+        }
+
+        /* Move the blocks from the available list to the cache.  */
+        pool_ptr -> tx_block_pool_available =  available - refill_count;
+        while (refill_count != ((UINT) 0))
+        {
+
+            /* Pickup the first available block.  */
+            work_ptr =        pool_ptr -> tx_block_pool_available_list;
+            next_block_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+            pool_ptr -> tx_block_pool_available_list =  *next_block_ptr;
+
+            /* Cached blocks are allocated from the pool, save the pool's address in the block.  */
+            temp_ptr =  TX_BLOCK_POOL_TO_UCHAR_POINTER_CONVERT(pool_ptr);
+            *next_block_ptr =  temp_ptr;
+
+            /* Link the block in the cache through its first word.  */
+            temp_ptr =  TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(UCHAR *)));
+            link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(temp_ptr);
+            *link_ptr =  thread_ptr -> tx_thread_block_cache_list;
+            thread_ptr -> tx_thread_block_cache_list =  work_ptr;
+            thread_ptr -> tx_thread_block_cache_count++;
+
+            refill_count--;
+        }
+
+        /* Bind the cache to this pool.  */
+        if (thread_ptr -> tx_thread_block_cache_list != TX_NULL)
+        {
+
+            thread_ptr -> tx_thread_block_cache_pool =  pool_ptr;
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Determine if the pool is empty.  */
+        if (thread_ptr -> tx_thread_block_cache_list == TX_NULL)
+        {
+
+            /* Use the pool, the thread may suspend.  */
+            return(TX_NOT_DONE);
+        }
+    }
+
+    /* Take the first cached block. The list is unlinked before the count is
+       decremented, so that a flush of a terminated thread only walks the list.  */
+    work_ptr =  thread_ptr -> tx_thread_block_cache_list;
+    temp_ptr =  TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(UCHAR *)));
+    link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(temp_ptr);
+    thread_ptr -> tx_thread_block_cache_list =  *link_ptr;
+    thread_ptr -> tx_thread_block_cache_count--;
+
+#ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
+
+    /* Increment the number of allocations served by the cache.  */
+    thread_ptr -> tx_thread_block_cache_allocate_count++;
+#endif
+
+    /* Return the block to the caller.  */
+    return_ptr =  TX_INDIRECT_VOID_TO_UCHAR_POINTER_CONVERT(block_ptr);
+    *return_ptr =  temp_ptr;
+
+    /* Return successful completion.  */
+    return(TX_SUCCESS);
+}
+#endif
@@ -0,0 +1,199 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Pool                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_block_pool.h"
+
+
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_pool_thread_cache_flush                   PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function gives all the blocks of the block cache of the        */
+/*    specified thread back to their pool and unbinds the cache. The      */
+/*    cache counters of the thread are added to the pool. If threads are  */
+/*    suspended on the pool, the blocks are released one by one so that   */
+/*    the suspended threads are resumed.                                  */
+/*                                                                        */
+/*    The thread must be the current thread, or a thread that is          */
+/*    terminated or completed.                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to thread                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_block_release                 Release a memory block            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_block_pool_thread_cache_allocate                                */
+/*                                      Allocate from the thread cache    */
+/*    _tx_thread_delete                 Delete thread                     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_block_pool_thread_cache_flush(TX_THREAD *thread_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_BLOCK_POOL       *pool_ptr;
+UCHAR               *cache_list;
+UCHAR               *work_ptr;
+UCHAR               *temp_ptr;
+UCHAR               **link_ptr;
+UINT                suspended;
+UINT                count;
+
+
+    /* Disable interrupts to give the blocks back to the pool.  */
+    TX_DISABLE
+
+    /* Unbind the cache of the thread.  */
+    pool_ptr =    thread_ptr -> tx_thread_block_cache_pool;
+    cache_list =  thread_ptr -> tx_thread_block_cache_list;
+    thread_ptr -> tx_thread_block_cache_pool =   TX_NULL;
+    thread_ptr -> tx_thread_block_cache_list =   TX_NULL;
+    thread_ptr -> tx_thread_block_cache_count =  ((UINT) 0);
+
+    /* Determine if the cache was bound to a pool.  */
+    if (pool_ptr == TX_NULL)
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Nothing to flush.  */
+        return;
+    }
+
+    /* Count the cached blocks, the list is walked rather than relying on the
+       count of a thread that may have been terminated in a cache update.  */
+    count =     ((UINT) 0);
+    work_ptr =  cache_list;
+    while (work_ptr != TX_NULL)
+    {
+
+        count++;
+        temp_ptr =  TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(UCHAR *)));
+        link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(temp_ptr);
+        work_ptr =  *link_ptr;
+    }
+
+    /* Determine if threads are waiting for a block.  */
+    suspended =  pool_ptr -> tx_block_pool_suspended_count;
+
+#ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
+
+    /* Add the counters of the thread to the pool and the totals.  */
+    pool_ptr -> tx_block_pool_performance_cache_allocate_count =
+                    pool_ptr -> tx_block_pool_performance_cache_allocate_count + thread_ptr -> tx_thread_block_cache_allocate_count;
+    pool_ptr -> tx_block_pool_performance_cache_release_count =
+                    pool_ptr -> tx_block_pool_performance_cache_release_count + thread_ptr -> tx_thread_block_cache_release_count;
+    _tx_block_pool_performance_cache_allocate_count =
+                    _tx_block_pool_performance_cache_allocate_count + thread_ptr -> tx_thread_block_cache_allocate_count;
+    _tx_block_pool_performance_cache_release_count =
+                    _tx_block_pool_performance_cache_release_count + thread_ptr -> tx_thread_block_cache_release_count;
+    thread_ptr -> tx_thread_block_cache_allocate_count =  ((ULONG) 0);
+    thread_ptr -> tx_thread_block_cache_release_count =   ((ULONG) 0);
+
+    /* The blocks released below to resume the suspended threads are not
+       releases of the application.  */
+    if (suspended != TX_NO_SUSPENSIONS)
+    {
+
+        pool_ptr -> tx_block_pool_performance_release_count =  pool_ptr -> tx_block_pool_performance_release_count - ((ULONG) count);
+        _tx_block_pool_performance_release_count =             _tx_block_pool_performance_release_count - ((ULONG) count);
+    }
+#endif
+
+    /* Determine if the blocks can go back in the available list.  */
+    if (suspended == TX_NO_SUSPENSIONS)
+    {
+
+        /* Put each block back in the available list.  */
+        while (cache_list != TX_NULL)
+        {
+
+            work_ptr =    cache_list;
+            temp_ptr =    TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(UCHAR *)));
+            link_ptr =    TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(temp_ptr);
+            cache_list =  *link_ptr;
+
+            link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+            *link_ptr =  pool_ptr -> tx_block_pool_available_list;
+            pool_ptr -> tx_block_pool_available_list =  work_ptr;
+        }
+
+        /* Increment the count of available blocks.  */
+        pool_ptr -> tx_block_pool_available =  pool_ptr -> tx_block_pool_available + count;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+    else
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Release each block, the pool's address is still in the block.  */
+        while (cache_list != TX_NULL)
+        {
+
+            work_ptr =    cache_list;
+            temp_ptr =    TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(UCHAR *)));
+            link_ptr =    TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(temp_ptr);
+            cache_list =  *link_ptr;
+
+            /* Release the block.  */
+            (VOID) _tx_block_release(temp_ptr);
+        }
+    }
+}
+#endif
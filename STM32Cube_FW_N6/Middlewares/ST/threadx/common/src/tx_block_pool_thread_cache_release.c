@@ -0,0 +1,187 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Pool                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_block_pool.h"
+
+
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_pool_thread_cache_release                 PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function releases a block to the block cache of the current    */
+/*    thread, without disabling interrupts, if the cache is bound to the  */
+/*    pool of the block and no thread is suspended on this pool. A full   */
+/*    cache first gives TX_BLOCK_POOL_THREAD_CACHE_REFILL blocks back to  */
+/*    the pool in a single interrupt lockout.                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    block_ptr                         Pointer to memory block           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            TX_SUCCESS if the block is put in */
+/*                                        the cache, TX_NOT_DONE if the   */
+/*                                        pool must be used               */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_block_release                 Release a memory block            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_block_pool_thread_cache_release(VOID *block_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD           *thread_ptr;
+TX_BLOCK_POOL       *pool_ptr;
+UCHAR               *work_ptr;
+UCHAR               *temp_ptr;
+UCHAR               *cached_ptr;
+UCHAR               **next_block_ptr;
+UCHAR               **link_ptr;
+UINT                flush_count;
+
+
+    /* Pickup thread pointer.  */
+    TX_THREAD_GET_CURRENT(thread_ptr)
+
+    /* The cache is only used from thread context.  */
+    if ((thread_ptr == TX_NULL) || (TX_THREAD_GET_SYSTEM_STATE() != ((ULONG) 0)))
+    {
+
+        /* Use the pool.  */
+        return(TX_NOT_DONE);
+    }
+
+    /* Pickup the pool pointer which is just previous to the starting
+       address of the block that the caller sees.  */
+    work_ptr =        TX_VOID_TO_UCHAR_POINTER_CONVERT(block_ptr);
+    work_ptr =        TX_UCHAR_POINTER_SUB(work_ptr, (sizeof(UCHAR *)));
+    next_block_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+    pool_ptr =        TX_UCHAR_TO_BLOCK_POOL_POINTER_CONVERT((*next_block_ptr));
+
+    /* Blocks of another pool, and blocks a suspended thread is waiting for,
+       go to the pool.  */
+    if ((thread_ptr -> tx_thread_block_cache_pool != pool_ptr) ||
+        (pool_ptr -> tx_block_pool_suspended_count != TX_NO_SUSPENSIONS))
+    {
+
+        /* Use the pool.  */
+        return(TX_NOT_DONE);
+    }
+
+    /* Determine if the cache is full.  */
+    if (thread_ptr -> tx_thread_block_cache_count >= TX_BLOCK_POOL_THREAD_CACHE_SIZE)
+    {
+
+        /* Disable interrupts to give blocks back to the pool.  */
+        TX_DISABLE
+
+        /* Determine if a thread has suspended on the pool in the meantime.  */
+        if (pool_ptr -> tx_block_pool_suspended_count != TX_NO_SUSPENSIONS)
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Use the pool.  */
+            return(TX_NOT_DONE);
+        }
+
+        /* Move the first cached blocks to the available list. The pool's
+           address is already in the block.  */
+        flush_count =  TX_BLOCK_POOL_THREAD_CACHE_REFILL;
+        if (flush_count > thread_ptr -> tx_thread_block_cache_count)
+        {
+
+            flush_count =  thread_ptr -> tx_thread_block_cache_count;
+        }
+        pool_ptr -> tx_block_pool_available =  pool_ptr -> tx_block_pool_available + flush_count;
+        while (flush_count != ((UINT) 0))
+        {
+
+            /* Unlink the first cached block.  */
+            cached_ptr =  thread_ptr -> tx_thread_block_cache_list;
+            temp_ptr =    TX_UCHAR_POINTER_ADD(cached_ptr, (sizeof(UCHAR *)));
+            link_ptr =    TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(temp_ptr);
+            thread_ptr -> tx_thread_block_cache_list =  *link_ptr;
+            thread_ptr -> tx_thread_block_cache_count--;
+
+            /* Put the block back in the available list.  */
+            link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(cached_ptr);
+            *link_ptr =  pool_ptr -> tx_block_pool_available_list;
+            pool_ptr -> tx_block_pool_available_list =  cached_ptr;
+
+            flush_count--;
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+
+    /* Put the block first in the cache.  The block is linked before the count
+       is incremented, so that a flush of a terminated thread only walks the list.  */
+    temp_ptr =  TX_VOID_TO_UCHAR_POINTER_CONVERT(block_ptr);
+    link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(temp_ptr);
+    *link_ptr =  thread_ptr -> tx_thread_block_cache_list;
+    thread_ptr -> tx_thread_block_cache_list =  work_ptr;
+    thread_ptr -> tx_thread_block_cache_count++;
+
+#ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
+
+    /* Increment the number of releases served by the cache.  */
+    thread_ptr -> tx_thread_block_cache_release_count++;
+#endif
+
+    /* Return successful completion.  */
+    return(TX_SUCCESS);
+}
+#endif
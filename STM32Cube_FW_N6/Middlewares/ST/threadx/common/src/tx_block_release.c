@@ -56,6 +56,8 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _tx_block_pool_thread_cache_release                                 */
+/*                                      Release to the thread cache       */
 /*    _tx_thread_system_resume          Resume thread service             */
 /*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
 /*                                                                        */
@@ -87,6 +89,17 @@ TX_THREAD           *next_thread;
 TX_THREAD           *previous_thread;
 
 
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+
+    /* Try the block cache of the current thread first.  */
+    if (_tx_block_pool_thread_cache_release(block_ptr) == TX_SUCCESS)
+    {
+
+        /* Return successful completion status.  */
+        return(TX_SUCCESS);
+    }
+#endif
+
     /* Disable interrupts to put this block back in the pool.  */
     TX_DISABLE
 
@@ -58,7 +58,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _tx_byte_pool_tlsf_insert         Insert block in free list         */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -140,6 +140,12 @@ ALIGN_TYPE          *free_ptr;
     free_ptr =             TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(block_ptr);
     *free_ptr =            TX_BYTE_BLOCK_FREE;
 
+#ifdef TX_BYTE_POOL_ENABLE_TLSF
+
+    /* Put the large available block on its segregated free list.  */
+    _tx_byte_pool_tlsf_insert(pool_ptr, TX_VOID_TO_UCHAR_POINTER_CONVERT(pool_start));
+#endif
+
     /* Clear the owner id.  */
     pool_ptr -> tx_byte_pool_owner =  TX_NULL;
 
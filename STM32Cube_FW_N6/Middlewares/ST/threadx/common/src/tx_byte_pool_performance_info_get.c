@@ -47,6 +47,11 @@
 /*    This function retrieves performance information from the specified  */
 /*    byte pool.                                                          */
 /*                                                                        */
+/*    With TX_BYTE_POOL_ENABLE_TLSF, the fragments searched are the free  */
+/*    blocks examined in the segregated free lists, one per allocation    */
+/*    except for requests above the largest size class, and the merges    */
+/*    are the free neighbors merged when a block is released.             */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    pool_ptr                          Pointer to byte pool control block*/
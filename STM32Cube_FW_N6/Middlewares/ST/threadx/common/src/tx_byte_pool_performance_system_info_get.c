@@ -45,6 +45,11 @@
 /*                                                                        */
 /*    This function retrieves byte pool performance information.          */
 /*                                                                        */
+/*    With TX_BYTE_POOL_ENABLE_TLSF, the fragments searched are the free  */
+/*    blocks examined in the segregated free lists, one per allocation    */
+/*    except for requests above the largest size class, and the merges    */
+/*    are the free neighbors merged when a block is released.             */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    allocates                         Destination for total number of   */
@@ -30,6 +30,7 @@
 #include "tx_byte_pool.h"
 
 
+#ifndef TX_BYTE_POOL_ENABLE_TLSF
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
@@ -351,4 +352,269 @@ ULONG           total_theoretical_available;
     /* Return the search pointer.  */
     return(current_ptr);
 }
+#else
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_search                                PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is the segregated fit version of the byte pool        */
+/*    search. The request is rounded up to the next free list boundary    */
+/*    so that any block of the first non-empty list at or above it fits.  */
+/*    This list is found in the pool bitmaps in constant time, the block  */
+/*    is removed from it and split if the remainder is large enough to    */
+/*    hold a free block. The list of the request size itself is only      */
+/*    searched when no larger block is free, and requests mapped to the   */
+/*    last list, which holds blocks of any size above the first level     */
+/*    limit, search that list.                                            */
+/*                                                                        */
+/*    Interrupts remain disabled during the whole search, its duration    */
+/*    does not depend on the number of fragments in the pool.             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    memory_size                       Number of bytes required          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    UCHAR *                           Pointer to the allocated memory,  */
+/*                                        if successful.  Otherwise, a    */
+/*                                        NULL is returned                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_mapping        Compute block free list           */
+/*    _tx_byte_pool_tlsf_insert         Insert block in free list         */
+/*    _tx_byte_pool_tlsf_remove         Remove block from free list       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_allocate                 Allocate bytes of memory          */
+/*    _tx_byte_release                  Release bytes of memory           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+UCHAR  *_tx_byte_pool_search(TX_BYTE_POOL *pool_ptr, ULONG memory_size)
+{
+
+TX_INTERRUPT_SAVE_AREA
 
+UCHAR           *current_ptr;
+UCHAR           *next_ptr;
+UCHAR           *work_ptr;
+UCHAR           **this_block_link_ptr;
+UCHAR           **next_block_link_ptr;
+ALIGN_TYPE      *free_ptr;
+ULONG           request_size;
+ULONG           search_size;
+ULONG           block_size;
+ULONG           bit_map;
+ULONG           highest_bit;
+ULONG           lowest_bit;
+UINT            first_level;
+UINT            second_level;
+
+
+    /* Compute the size of the block needed, large enough to hold the free list
+       links once released.  */
+    request_size =  memory_size + TX_BYTE_POOL_TLSF_OVERHEAD;
+    if (request_size < TX_BYTE_POOL_TLSF_BLOCK_MIN)
+    {
+
+        /* Use the minimum block size.  */
+        request_size =  TX_BYTE_POOL_TLSF_BLOCK_MIN;
+    }
+
+    /* Round the size up to the next free list boundary.  */
+    search_size =  request_size;
+    if (search_size >= (((ULONG) 1) << TX_BYTE_POOL_TLSF_FL_SHIFT))
+    {
+
+        bit_map =  search_size;
+        TX_BYTE_POOL_TLSF_HIGHEST_SET_BIT_CALCULATE(bit_map, highest_bit)
+        search_size =  search_size + ((((ULONG) 1) << (highest_bit - ((ULONG) TX_BYTE_POOL_TLSF_SL_SHIFT))) - ((ULONG) 1));
+    }
+    else
+    {
+
+        search_size =  search_size + ((((ULONG) 1) << (TX_BYTE_POOL_TLSF_FL_SHIFT - TX_BYTE_POOL_TLSF_SL_SHIFT)) - ((ULONG) 1));
+    }
+
+    /* Check for an overflow of the size computations.  */
+    if ((request_size < memory_size) || (search_size < request_size))
+    {
+
+        /* Request larger than any pool, return a NULL pointer.  */
+        current_ptr =  TX_NULL;
+    }
+    else
+    {
+
+        /* Compute the first list to examine.  */
+        _tx_byte_pool_tlsf_mapping(search_size, &first_level, &second_level);
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Find the first non-empty list at or above this one.  */
+        current_ptr =  TX_NULL;
+        bit_map =  pool_ptr -> tx_byte_pool_tlsf_sl_bitmap[first_level] & ((~((ULONG) 0)) << second_level);
+        if (bit_map == ((ULONG) 0))
+        {
+
+            /* No list in this class, look for a larger class.  */
+            if ((first_level + ((UINT) 1)) < ((UINT) TX_BYTE_POOL_TLSF_FL_COUNT))
+            {
+
+                bit_map =  pool_ptr -> tx_byte_pool_tlsf_fl_bitmap & ((~((ULONG) 0)) << (first_level + ((UINT) 1)));
+            }
+            if (bit_map != ((ULONG) 0))
+            {
+
+                TX_LOWEST_SET_BIT_CALCULATE(bit_map, lowest_bit)
+                first_level =  (UINT) lowest_bit;
+                bit_map =  pool_ptr -> tx_byte_pool_tlsf_sl_bitmap[first_level];
+            }
+        }
+        if (bit_map != ((ULONG) 0))
+        {
+
+            /* Pickup the head of the list.  */
+            TX_LOWEST_SET_BIT_CALCULATE(bit_map, lowest_bit)
+            second_level =  (UINT) lowest_bit;
+            current_ptr =   pool_ptr -> tx_byte_pool_tlsf_free_list[first_level][second_level];
+        }
+        else
+        {
+
+            /* No list holds blocks that are all large enough, the request may still
+               fit a block of its own list, for example the whole pool.  */
+            _tx_byte_pool_tlsf_mapping(request_size, &first_level, &second_level);
+            current_ptr =  pool_ptr -> tx_byte_pool_tlsf_free_list[first_level][second_level];
+        }
+
+        /* Walk the list while its blocks are too small. This only happens in the
+           list of the request size and in the last list, all other lists found
+           hold blocks larger than the request.  */
+        while (current_ptr != TX_NULL)
+        {
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+            /* Increment the total fragment search counter.  */
+            _tx_byte_pool_performance_search_count++;
+
+            /* Increment the number of fragments searched on this pool.  */
+            pool_ptr -> tx_byte_pool_performance_search_count++;
+#endif
+
+            /* Determine if the block is large enough.  */
+            this_block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(current_ptr);
+            next_ptr =             *this_block_link_ptr;
+            if (TX_UCHAR_POINTER_DIF(next_ptr, current_ptr) >= request_size)
+            {
+
+                /* Yes, get out of the search loop.  */
+                break;
+            }
+
+            /* Move to the next block of the list.  */
+            work_ptr =             TX_UCHAR_POINTER_ADD(current_ptr, TX_BYTE_POOL_TLSF_OVERHEAD);
+            this_block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+            current_ptr =          *this_block_link_ptr;
+        }
+
+        /* Determine if a block was found.  */
+        if (current_ptr != TX_NULL)
+        {
+
+            /* Remove the block from its free list.  */
+            _tx_byte_pool_tlsf_remove(pool_ptr, current_ptr);
+
+            /* Determine if we need to split this block.  */
+            this_block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(current_ptr);
+            next_ptr =             *this_block_link_ptr;
+            block_size =           TX_UCHAR_POINTER_DIF(next_ptr, current_ptr);
+            if ((block_size - request_size) >= TX_BYTE_POOL_TLSF_BLOCK_MIN)
+            {
+
+                /* Split the block.  */
+                next_ptr =  TX_UCHAR_POINTER_ADD(current_ptr, request_size);
+
+                /* Setup the new free block.  */
+                next_block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(next_ptr);
+                *next_block_link_ptr =  *this_block_link_ptr;
+                work_ptr =              TX_UCHAR_POINTER_ADD(next_ptr, (sizeof(UCHAR *)));
+                free_ptr =              TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(work_ptr);
+                *free_ptr =             TX_BYTE_BLOCK_FREE;
+
+                /* Increase the total fragment counter.  */
+                pool_ptr -> tx_byte_pool_fragments++;
+
+                /* Update the current pointer to point at the newly created block.  */
+                *this_block_link_ptr =  next_ptr;
+
+                /* Put the remainder on its free list.  */
+                _tx_byte_pool_tlsf_insert(pool_ptr, next_ptr);
+
+                /* The block now has the requested size.  */
+                block_size =  request_size;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+                /* Increment the total split counter.  */
+                _tx_byte_pool_performance_split_count++;
+
+                /* Increment the number of blocks split on this pool.  */
+                pool_ptr -> tx_byte_pool_performance_split_count++;
+#endif
+            }
+            else
+            {
+
+                /* The whole block is used, the next block no longer follows a free block.  */
+                work_ptr =   TX_UCHAR_POINTER_ADD(next_ptr, (sizeof(UCHAR *)));
+                free_ptr =   TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(work_ptr);
+                *free_ptr =  (*free_ptr) & (~TX_BYTE_POOL_TLSF_PREVIOUS_FREE);
+            }
+
+            /* In any case, mark the current block as allocated.  A free block never
+               follows another free block, so the previous free flag is clear.  */
+            work_ptr =              TX_UCHAR_POINTER_ADD(current_ptr, (sizeof(UCHAR *)));
+            this_block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+            *this_block_link_ptr =  TX_BYTE_POOL_TO_UCHAR_POINTER_CONVERT(pool_ptr);
+
+            /* Reduce the number of available bytes in the pool.  */
+            pool_ptr -> tx_byte_pool_available =  pool_ptr -> tx_byte_pool_available - block_size;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Adjust the pointer for the application.  */
+            current_ptr =  TX_UCHAR_POINTER_ADD(current_ptr, TX_BYTE_POOL_TLSF_OVERHEAD);
+        }
+        else
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+        }
+    }
+
+    /* Return the search pointer.  */
+    return(current_ptr);
+}
+#endif
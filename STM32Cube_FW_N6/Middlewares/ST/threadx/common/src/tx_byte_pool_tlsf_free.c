@@ -0,0 +1,157 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+#ifdef TX_BYTE_POOL_ENABLE_TLSF
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_free                             PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns an allocated block to the pool. The block is  */
+/*    merged with its next physical block if free, and with its previous  */
+/*    physical block if the previous free flag is set in its header, the  */
+/*    resulting block is then inserted in its segregated free list.       */
+/*                                                                        */
+/*    It is assumed that this function is called with interrupts          */
+/*    disabled.                                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    block_ptr                         Pointer to the allocated block    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_insert         Insert block in free list         */
+/*    _tx_byte_pool_tlsf_remove         Remove block from free list       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_release                  Release byte memory               */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_byte_pool_tlsf_free(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr)
+{
+
+UCHAR           *next_ptr;
+UCHAR           *previous_ptr;
+UCHAR           *work_ptr;
+UCHAR           **this_block_link_ptr;
+UCHAR           **link_ptr;
+ALIGN_TYPE      *free_ptr;
+ALIGN_TYPE      previous_free;
+
+
+    /* Mark the block as free, remembering if the previous block is free.  */
+    work_ptr =       TX_UCHAR_POINTER_ADD(block_ptr, (sizeof(UCHAR *)));
+    free_ptr =       TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(work_ptr);
+    previous_free =  (*free_ptr) & TX_BYTE_POOL_TLSF_PREVIOUS_FREE;
+    *free_ptr =      TX_BYTE_BLOCK_FREE;
+
+    /* Update the number of available bytes in the pool.  */
+    this_block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(block_ptr);
+    next_ptr =             *this_block_link_ptr;
+    pool_ptr -> tx_byte_pool_available =
+        pool_ptr -> tx_byte_pool_available + TX_UCHAR_POINTER_DIF(next_ptr, block_ptr);
+
+    /* Determine if the next block is free.  */
+    work_ptr =  TX_UCHAR_POINTER_ADD(next_ptr, (sizeof(UCHAR *)));
+    free_ptr =  TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(work_ptr);
+    if ((*free_ptr) == TX_BYTE_BLOCK_FREE)
+    {
+
+        /* Yes, take it off its free list and merge it.  */
+        _tx_byte_pool_tlsf_remove(pool_ptr, next_ptr);
+        link_ptr =              TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(next_ptr);
+        *this_block_link_ptr =  *link_ptr;
+
+        /* Reduce the fragment total.  */
+        pool_ptr -> tx_byte_pool_fragments--;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+        /* Increment the total merge counter.  */
+        _tx_byte_pool_performance_merge_count++;
+
+        /* Increment the number of blocks merged on this pool.  */
+        pool_ptr -> tx_byte_pool_performance_merge_count++;
+#endif
+    }
+
+    /* Determine if the previous block is free.  */
+    if (previous_free != ((ALIGN_TYPE) 0))
+    {
+
+        /* Yes, pickup its address from its last word.  */
+        work_ptr =      TX_UCHAR_POINTER_SUB(block_ptr, (sizeof(UCHAR *)));
+        link_ptr =      TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+        previous_ptr =  *link_ptr;
+
+        /* Take it off its free list and merge the block in it.  */
+        _tx_byte_pool_tlsf_remove(pool_ptr, previous_ptr);
+        link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(previous_ptr);
+        *link_ptr =  *this_block_link_ptr;
+        block_ptr =  previous_ptr;
+
+        /* Reduce the fragment total.  */
+        pool_ptr -> tx_byte_pool_fragments--;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+        /* Increment the total merge counter.  */
+        _tx_byte_pool_performance_merge_count++;
+
+        /* Increment the number of blocks merged on this pool.  */
+        pool_ptr -> tx_byte_pool_performance_merge_count++;
+#endif
+    }
+
+    /* Put the resulting block on its free list.  */
+    _tx_byte_pool_tlsf_insert(pool_ptr, block_ptr);
+}
+#endif
@@ -0,0 +1,127 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+#ifdef TX_BYTE_POOL_ENABLE_TLSF
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_insert                           PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function inserts a free block at the head of its segregated    */
+/*    free list, sets the list bits in the pool bitmaps, stores the       */
+/*    block address in its last word and flags the next physical block    */
+/*    as following a free block.                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    block_ptr                         Pointer to the free block,        */
+/*                                        already marked with             */
+/*                                        TX_BYTE_BLOCK_FREE              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_mapping        Compute block free list           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_pool_create              Create byte memory pool           */
+/*    _tx_byte_pool_search              Search byte pool for memory       */
+/*    _tx_byte_pool_tlsf_free           Return block to byte pool         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_byte_pool_tlsf_insert(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr)
+{
+
+UCHAR           *next_ptr;
+UCHAR           *head_ptr;
+UCHAR           *work_ptr;
+UCHAR           **link_ptr;
+ALIGN_TYPE      *free_ptr;
+UINT            first_level;
+UINT            second_level;
+
+
+    /* Pickup the next physical block and compute the free list of the block.  */
+    link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(block_ptr);
+    next_ptr =  *link_ptr;
+    _tx_byte_pool_tlsf_mapping(TX_UCHAR_POINTER_DIF(next_ptr, block_ptr), &first_level, &second_level);
+
+    /* Link the block at the head of the free list.  */
+    head_ptr =  pool_ptr -> tx_byte_pool_tlsf_free_list[first_level][second_level];
+    work_ptr =  TX_UCHAR_POINTER_ADD(block_ptr, TX_BYTE_POOL_TLSF_OVERHEAD);
+    link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+    *link_ptr =  head_ptr;
+    work_ptr =  TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(UCHAR *)));
+    link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+    *link_ptr =  TX_NULL;
+    if (head_ptr != TX_NULL)
+    {
+
+        /* Update the previous link of the former head.  */
+        work_ptr =  TX_UCHAR_POINTER_ADD(head_ptr, (TX_BYTE_POOL_TLSF_OVERHEAD + (sizeof(UCHAR *))));
+        link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+        *link_ptr =  block_ptr;
+    }
+    pool_ptr -> tx_byte_pool_tlsf_free_list[first_level][second_level] =  block_ptr;
+
+    /* Mark the list as not empty.  */
+    pool_ptr -> tx_byte_pool_tlsf_fl_bitmap =  pool_ptr -> tx_byte_pool_tlsf_fl_bitmap | (((ULONG) 1) << first_level);
+    pool_ptr -> tx_byte_pool_tlsf_sl_bitmap[first_level] =  pool_ptr -> tx_byte_pool_tlsf_sl_bitmap[first_level] | (((ULONG) 1) << second_level);
+
+    /* Store the block address in its last word for the merge with the next block.  */
+    work_ptr =  TX_UCHAR_POINTER_SUB(next_ptr, (sizeof(UCHAR *)));
+    link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+    *link_ptr =  block_ptr;
+
+    /* Flag the next block, always allocated, as following a free block.  */
+    work_ptr =  TX_UCHAR_POINTER_ADD(next_ptr, (sizeof(UCHAR *)));
+    free_ptr =  TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(work_ptr);
+    *free_ptr =  (*free_ptr) | TX_BYTE_POOL_TLSF_PREVIOUS_FREE;
+}
+#endif
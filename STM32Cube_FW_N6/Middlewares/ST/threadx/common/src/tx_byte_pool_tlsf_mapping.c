@@ -0,0 +1,120 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+#ifdef TX_BYTE_POOL_ENABLE_TLSF
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_mapping                          PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes the segregated free list of a block size:    */
+/*    the first level is the power of two class of the size, the          */
+/*    second level the linear range within the class. Sizes below the     */
+/*    first class are mapped linearly in the first level 0. Sizes         */
+/*    above the largest class are mapped to the last list.                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    block_size                        Block size in bytes, header       */
+/*                                        included                        */
+/*    first_level                       Destination for the first         */
+/*                                        level index                     */
+/*    second_level                      Destination for the second        */
+/*                                        level index                     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_pool_search              Search byte pool for memory       */
+/*    _tx_byte_pool_tlsf_insert         Insert free block in its list     */
+/*    _tx_byte_pool_tlsf_remove         Remove free block from its list   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_byte_pool_tlsf_mapping(ULONG block_size, UINT *first_level, UINT *second_level)
+{
+
+ULONG       work_size;
+ULONG       highest_bit;
+
+
+    /* Determine if the size is below the first power of two class.  */
+    if (block_size < (((ULONG) 1) << TX_BYTE_POOL_TLSF_FL_SHIFT))
+    {
+
+        /* Yes, small blocks are linearly mapped in the first level 0.  */
+        *first_level =   ((UINT) 0);
+        *second_level =  (UINT) (block_size >> (TX_BYTE_POOL_TLSF_FL_SHIFT - TX_BYTE_POOL_TLSF_SL_SHIFT));
+    }
+    else
+    {
+
+        /* Pickup the power of two class of the size.  */
+        work_size =  block_size;
+        TX_BYTE_POOL_TLSF_HIGHEST_SET_BIT_CALCULATE(work_size, highest_bit)
+
+        /* Determine if the size is above the largest class.  */
+        if (highest_bit > ((ULONG) TX_BYTE_POOL_TLSF_FL_MAX))
+        {
+
+            /* Yes, use the last list.  */
+            *first_level =   ((UINT) (TX_BYTE_POOL_TLSF_FL_COUNT - 1));
+            *second_level =  ((UINT) (TX_BYTE_POOL_TLSF_SL_COUNT - 1));
+        }
+        else
+        {
+
+            /* The second level is given by the bits following the highest bit.  */
+            *first_level =   (UINT) ((highest_bit - ((ULONG) TX_BYTE_POOL_TLSF_FL_SHIFT)) + ((ULONG) 1));
+            *second_level =  (UINT) ((block_size >> (highest_bit - ((ULONG) TX_BYTE_POOL_TLSF_SL_SHIFT))) - ((ULONG) TX_BYTE_POOL_TLSF_SL_COUNT));
+        }
+    }
+}
+#endif
@@ -0,0 +1,131 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+#ifdef TX_BYTE_POOL_ENABLE_TLSF
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_remove                           PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes a free block from its segregated free list    */
+/*    and clears the list bits in the pool bitmaps when the list gets     */
+/*    empty.                                                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    block_ptr                         Pointer to the free block         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_mapping        Compute block free list           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_pool_search              Search byte pool for memory       */
+/*    _tx_byte_pool_tlsf_free           Return block to byte pool         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_byte_pool_tlsf_remove(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr)
+{
+
+UCHAR           *next_free_ptr;
+UCHAR           *previous_free_ptr;
+UCHAR           *work_ptr;
+UCHAR           **link_ptr;
+UINT            first_level;
+UINT            second_level;
+
+
+    /* Pickup the free list links of the block.  */
+    work_ptr =           TX_UCHAR_POINTER_ADD(block_ptr, TX_BYTE_POOL_TLSF_OVERHEAD);
+    link_ptr =           TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+    next_free_ptr =      *link_ptr;
+    work_ptr =           TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(UCHAR *)));
+    link_ptr =           TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+    previous_free_ptr =  *link_ptr;
+
+    /* Unlink the block from its neighbors in the list.  */
+    if (next_free_ptr != TX_NULL)
+    {
+
+        work_ptr =   TX_UCHAR_POINTER_ADD(next_free_ptr, (TX_BYTE_POOL_TLSF_OVERHEAD + (sizeof(UCHAR *))));
+        link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+        *link_ptr =  previous_free_ptr;
+    }
+    if (previous_free_ptr != TX_NULL)
+    {
+
+        work_ptr =   TX_UCHAR_POINTER_ADD(previous_free_ptr, TX_BYTE_POOL_TLSF_OVERHEAD);
+        link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+        *link_ptr =  next_free_ptr;
+    }
+    else
+    {
+
+        /* The block is the head of its list, update the head.  */
+        link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(block_ptr);
+        work_ptr =  *link_ptr;
+        _tx_byte_pool_tlsf_mapping(TX_UCHAR_POINTER_DIF(work_ptr, block_ptr), &first_level, &second_level);
+        pool_ptr -> tx_byte_pool_tlsf_free_list[first_level][second_level] =  next_free_ptr;
+
+        /* Determine if the list is now empty.  */
+        if (next_free_ptr == TX_NULL)
+        {
+
+            /* Yes, clear its bit, and the class bit if the class is empty.  */
+            pool_ptr -> tx_byte_pool_tlsf_sl_bitmap[first_level] =  pool_ptr -> tx_byte_pool_tlsf_sl_bitmap[first_level] & (~(((ULONG) 1) << second_level));
+            if (pool_ptr -> tx_byte_pool_tlsf_sl_bitmap[first_level] == ((ULONG) 0))
+            {
+
+                pool_ptr -> tx_byte_pool_tlsf_fl_bitmap =  pool_ptr -> tx_byte_pool_tlsf_fl_bitmap & (~(((ULONG) 1) << first_level));
+            }
+        }
+    }
+}
+#endif
@@ -60,6 +60,7 @@
 /*    _tx_thread_system_resume          Resume thread service             */
 /*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
 /*    _tx_byte_pool_search              Search the byte pool for memory   */
+/*    _tx_byte_pool_tlsf_free           Return block to byte pool         */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -84,15 +85,19 @@ TX_BYTE_POOL        *pool_ptr;
 TX_THREAD           *thread_ptr;
 UCHAR               *work_ptr;
 UCHAR               *temp_ptr;
+#ifndef TX_BYTE_POOL_ENABLE_TLSF
 UCHAR               *next_block_ptr;
+#endif
 TX_THREAD           *susp_thread_ptr;
 UINT                suspended_count;
 TX_THREAD           *next_thread;
 TX_THREAD           *previous_thread;
 ULONG               memory_size;
 ALIGN_TYPE          *free_ptr;
+#ifndef TX_BYTE_POOL_ENABLE_TLSF
 TX_BYTE_POOL        **byte_pool_ptr;
 UCHAR               **block_link_ptr;
+#endif
 UCHAR               **suspend_info_ptr;
 
 
@@ -119,10 +124,17 @@ UCHAR               **suspend_info_ptr;
         if ((*free_ptr) != TX_BYTE_BLOCK_FREE)
         {
 
+#ifndef TX_BYTE_POOL_ENABLE_TLSF
+
             /* Pickup the pool pointer.  */
             temp_ptr =  TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(UCHAR *)));
             byte_pool_ptr =  TX_UCHAR_TO_INDIRECT_BYTE_POOL_POINTER(temp_ptr);
             pool_ptr =  *byte_pool_ptr;
+#else
+
+            /* Pickup the pool pointer, without the previous free block flag.  */
+            pool_ptr =  TX_VOID_TO_BYTE_POOL_POINTER_CONVERT(TX_ALIGN_TYPE_TO_POINTER_CONVERT((*free_ptr) & (~TX_BYTE_POOL_TLSF_PREVIOUS_FREE)));
+#endif
 
             /* See if we have a valid pool pointer.  */
             if (pool_ptr == TX_NULL)
@@ -193,6 +205,8 @@ UCHAR               **suspend_info_ptr;
         /* Log this kernel call.  */
         TX_EL_BYTE_RELEASE_INSERT
 
+#ifndef TX_BYTE_POOL_ENABLE_TLSF
+
         /* Release the memory.  */
         temp_ptr =   TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(UCHAR *)));
         free_ptr =   TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(temp_ptr);
@@ -211,6 +225,11 @@ UCHAR               **suspend_info_ptr;
             /* Yes, update the search pointer to the released block.  */
             pool_ptr -> tx_byte_pool_search =  work_ptr;
         }
+#else
+
+        /* Release the memory, merging it with its free neighbors.  */
+        _tx_byte_pool_tlsf_free(pool_ptr, work_ptr);
+#endif
 
         /* Determine if there are threads suspended on this byte pool.  */
         if (pool_ptr -> tx_byte_pool_suspended_count != TX_NO_SUSPENSIONS)
@@ -338,6 +357,7 @@ UCHAR               **suspend_info_ptr;
                     /* Put the memory back on the available list since this thread is no longer
                        suspended.  */
                     work_ptr =  TX_UCHAR_POINTER_SUB(work_ptr, (((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE)))));
+#ifndef TX_BYTE_POOL_ENABLE_TLSF
                     temp_ptr =  TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(UCHAR *)));
                     free_ptr =  TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(temp_ptr);
                     *free_ptr =  TX_BYTE_BLOCK_FREE;
@@ -355,6 +375,9 @@ UCHAR               **suspend_info_ptr;
                         /* Yes, update the search pointer.  */
                         pool_ptr -> tx_byte_pool_search =  work_ptr;
                     }
+#else
+                    _tx_byte_pool_tlsf_free(pool_ptr, work_ptr);
+#endif
                 }
             }
 
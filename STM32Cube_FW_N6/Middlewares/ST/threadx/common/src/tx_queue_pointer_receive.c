@@ -0,0 +1,216 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_pointer_receive                           PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function takes up to the specified number of pointers from a   */
+/*    queue of TX_POINTER_ULONG messages. When no thread is suspended on  */
+/*    the queue, the pointers in the queue are taken in a single          */
+/*    interrupt lockout. Otherwise, the pointers are received one by one, */
+/*    which moves the messages of the suspended senders into the queue.   */
+/*    This function only waits, as specified, when the queue is empty     */
+/*    before any pointer is received.                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to queue control block    */
+/*    pointer_array                     Destination array of pointers     */
+/*    count                             Size of the array in pointers     */
+/*    actual_count                      Destination for the number of     */
+/*                                        pointers received               */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_queue_receive                 Queue receive function            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_queue_pointer_receive(TX_QUEUE *queue_ptr, VOID **pointer_array, UINT count, UINT *actual_count, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+ULONG           *source;
+ULONG           *destination;
+UINT            size;
+UINT            received;
+UINT            batch;
+UINT            index;
+ULONG           enqueued;
+UINT            status;
+
+
+    /* Default the status to TX_SUCCESS.  */
+    status =  TX_SUCCESS;
+
+    /* Nothing is received yet.  */
+    received =  ((UINT) 0);
+
+    /* Loop until all the pointers are received or the queue is empty.  */
+    do
+    {
+
+        /* Disable interrupts to look at the queue.  */
+        TX_DISABLE
+
+        /* Pickup the enqueued count.  */
+        enqueued =  queue_ptr -> tx_queue_enqueued;
+
+        /* Determine if the pointers can be taken from the queue directly.  */
+        if ((queue_ptr -> tx_queue_suspended_count == TX_NO_SUSPENSIONS) && (enqueued != ((ULONG) 0)))
+        {
+
+            /* Calculate the number of pointers to take from the queue.  */
+            batch =  count - received;
+            if (((ULONG) batch) > enqueued)
+            {
+
+                /* Only take what is in the queue.  */
+                batch =  (UINT) enqueued;
+            }
+
+            /* Increase the amount of available storage.  */
+            queue_ptr -> tx_queue_available_storage =  queue_ptr -> tx_queue_available_storage + ((ULONG) batch);
+
+            /* Decrease the enqueued count.  */
+            queue_ptr -> tx_queue_enqueued =  enqueued - ((ULONG) batch);
+
+#ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
+
+            /* Increment the total messages received counter.  */
+            _tx_queue_performance__messages_received_count =  _tx_queue_performance__messages_received_count + ((ULONG) batch);
+
+            /* Increment the number of messages received from this queue.  */
+            queue_ptr -> tx_queue_performance_messages_received_count =  queue_ptr -> tx_queue_performance_messages_received_count + ((ULONG) batch);
+#endif
+
+            /* Setup source and destination pointers.  */
+            source =       queue_ptr -> tx_queue_read;
+            destination =  TX_VOID_TO_ULONG_POINTER_CONVERT(&pointer_array[received]);
+
+            /* Copy the pointers.  */
+            for (index = ((UINT) 0); index < batch; index++)
+            {
+
+                /* Copy one pointer. Note that the source and destination pointers are
+                   incremented by the macro.  */
+                size =  TX_POINTER_ULONG;
+                TX_QUEUE_MESSAGE_COPY(source, destination, size)
+
+                /* Determine if we are at the end.  */
+                if (source == queue_ptr -> tx_queue_end)
+                {
+
+                    /* Yes, wrap around to the beginning.  */
+                    source =  queue_ptr -> tx_queue_start;
+                }
+            }
+
+            /* Setup the queue read pointer.  */
+            queue_ptr -> tx_queue_read =  source;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Either all the pointers are received or the queue is empty.  */
+            received =  received + batch;
+            break;
+        }
+
+        /* Determine if the queue is empty after some pointers were received.  */
+        if ((received != ((UINT) 0)) && (enqueued == ((ULONG) 0)))
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Return the pointers received so far.  */
+            break;
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Receive the next pointer with the regular service, which moves the message
+           of a suspended sender into the queue or waits for a message.  */
+        status =  _tx_queue_receive(queue_ptr, (VOID *) &pointer_array[received], (received == ((UINT) 0)) ? wait_option : TX_NO_WAIT);
+
+        /* Determine if a pointer was received.  */
+        if (status != TX_SUCCESS)
+        {
+
+            /* No, stop here.  */
+            break;
+        }
+
+        /* Move to the next pointer.  */
+        received++;
+
+    } while (received < count);
+
+    /* Return the number of pointers received.  */
+    *actual_count =  received;
+
+    /* The call is successful if at least one pointer was received.  */
+    if (received != ((UINT) 0))
+    {
+
+        status =  TX_SUCCESS;
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
@@ -0,0 +1,236 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_pointer_send                              PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places up to the specified number of pointers in a    */
+/*    queue of TX_POINTER_ULONG messages. When no thread is suspended on  */
+/*    the queue, the pointers that fit are placed in the queue in a       */
+/*    single interrupt lockout and the send notify callback is called     */
+/*    once. Otherwise, the pointers are sent one by one, which gives them */
+/*    to the suspended receivers first. This function only waits, as      */
+/*    specified, when the queue is full before any pointer is sent.       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to queue control block    */
+/*    pointer_array                     Array of pointers to send         */
+/*    count                             Number of pointers in the array   */
+/*    actual_count                      Destination for the number of     */
+/*                                        pointers sent                   */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_queue_send                    Queue send function               */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_queue_pointer_send(TX_QUEUE *queue_ptr, VOID **pointer_array, UINT count, UINT *actual_count, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+ULONG           *source;
+ULONG           *destination;
+UINT            size;
+UINT            sent;
+UINT            batch;
+UINT            index;
+ULONG           available;
+UINT            status;
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
+#endif
+
+
+    /* Default the status to TX_SUCCESS.  */
+    status =  TX_SUCCESS;
+
+    /* Nothing is sent yet.  */
+    sent =  ((UINT) 0);
+
+    /* Loop until all the pointers are sent or the queue is full.  */
+    do
+    {
+
+        /* Disable interrupts to look at the queue.  */
+        TX_DISABLE
+
+        /* Pickup the available storage.  */
+        available =  queue_ptr -> tx_queue_available_storage;
+
+        /* Determine if the pointers can be placed in the queue directly.  */
+        if ((queue_ptr -> tx_queue_suspended_count == TX_NO_SUSPENSIONS) && (available != ((ULONG) 0)))
+        {
+
+            /* Calculate the number of pointers that fit in the queue.  */
+            batch =  count - sent;
+            if (((ULONG) batch) > available)
+            {
+
+                /* Only send what fits.  */
+                batch =  (UINT) available;
+            }
+
+            /* Reduce the amount of available storage.  */
+            queue_ptr -> tx_queue_available_storage =  available - ((ULONG) batch);
+
+            /* Increase the enqueued count.  */
+            queue_ptr -> tx_queue_enqueued =  queue_ptr -> tx_queue_enqueued + ((ULONG) batch);
+
+#ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
+
+            /* Increment the total messages sent counter.  */
+            _tx_queue_performance_messages_sent_count =  _tx_queue_performance_messages_sent_count + ((ULONG) batch);
+
+            /* Increment the number of messages sent to this queue.  */
+            queue_ptr -> tx_queue_performance_messages_sent_count =  queue_ptr -> tx_queue_performance_messages_sent_count + ((ULONG) batch);
+#endif
+
+            /* Setup source and destination pointers.  */
+            source =       TX_VOID_TO_ULONG_POINTER_CONVERT(&pointer_array[sent]);
+            destination =  queue_ptr -> tx_queue_write;
+
+            /* Copy the pointers.  */
+            for (index = ((UINT) 0); index < batch; index++)
+            {
+
+                /* Copy one pointer. Note that the source and destination pointers are
+                   incremented by the macro.  */
+                size =  TX_POINTER_ULONG;
+                TX_QUEUE_MESSAGE_COPY(source, destination, size)
+
+                /* Determine if we are at the end.  */
+                if (destination == queue_ptr -> tx_queue_end)
+                {
+
+                    /* Yes, wrap around to the beginning.  */
+                    destination =  queue_ptr -> tx_queue_start;
+                }
+            }
+
+            /* Adjust the write pointer.  */
+            queue_ptr -> tx_queue_write =  destination;
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+            /* Pickup the notify callback routine for this queue.  */
+            queue_send_notify =  queue_ptr -> tx_queue_send_notify;
+#endif
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+            /* Determine if a notify callback is required.  */
+            if (queue_send_notify != TX_NULL)
+            {
+
+                /* Call application queue notification once for the batch.  */
+                (queue_send_notify)(queue_ptr);
+            }
+#endif
+
+            /* Either all the pointers are sent or the queue is full.  */
+            sent =  sent + batch;
+            break;
+        }
+
+        /* Determine if the queue is full after some pointers were sent.  */
+        if ((sent != ((UINT) 0)) && (available == ((ULONG) 0)))
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Return the pointers sent so far.  */
+            break;
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Send the next pointer with the regular service, which hands it to a
+           suspended receiver or waits for room in the queue.  */
+        status =  _tx_queue_send(queue_ptr, (VOID *) &pointer_array[sent], (sent == ((UINT) 0)) ? wait_option : TX_NO_WAIT);
+
+        /* Determine if the pointer was sent.  */
+        if (status != TX_SUCCESS)
+        {
+
+            /* No, stop here.  */
+            break;
+        }
+
+        /* Move to the next pointer.  */
+        sent++;
+
+    } while (sent < count);
+
+    /* Return the number of pointers sent.  */
+    *actual_count =  sent;
+
+    /* The call is successful if at least one pointer was sent.  */
+    if (sent != ((UINT) 0))
+    {
+
+        status =  TX_SUCCESS;
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
@@ -28,6 +28,9 @@
 #include "tx_api.h"
 #include "tx_trace.h"
 #include "tx_thread.h"
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+#include "tx_block_pool.h"
+#endif
 
 
 /**************************************************************************/
@@ -56,7 +59,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _tx_block_pool_thread_cache_flush Flush the thread block cache      */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -84,6 +87,19 @@ UINT            status;
     /* Default status to success.  */
     status =  TX_SUCCESS;
 
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+
+    /* Give the cached blocks of a completed or terminated thread back to their
+       pool before it is deleted.  */
+    if (((thread_ptr -> tx_thread_state == TX_COMPLETED) || (thread_ptr -> tx_thread_state == TX_TERMINATED)) &&
+        (thread_ptr -> tx_thread_block_cache_pool != TX_NULL))
+    {
+
+        /* Flush the block cache.  */
+        _tx_block_pool_thread_cache_flush(thread_ptr);
+    }
+#endif
+
     /* Lockout interrupts while the thread is being deleted.  */
     TX_DISABLE
 
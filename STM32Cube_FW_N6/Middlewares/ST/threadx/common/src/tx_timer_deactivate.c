@@ -54,7 +54,8 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _tx_timer_wheel_boundary_get      Ticks to the next wheel timer     */
+/*                                        expiration                      */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -126,8 +127,25 @@ UINT                active_timer_list;
             }
         }
 
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+
+        /* Determine if the timer is on the timing wheel.  */
+        if ((TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(list_head) >= TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(&_tx_timer_wheel[0])) &&
+            (TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(list_head) < TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(&_tx_timer_wheel[TX_TIMER_WHEEL_SLOTS])))
+        {
+
+            /* Convert the expiration time on the wheel to the ticks left.  */
+            internal_ptr -> tx_timer_internal_remaining_ticks =
+                    (internal_ptr -> tx_timer_internal_remaining_ticks - _tx_timer_wheel_time) + _tx_timer_wheel_boundary_get();
+        }
+
+        /* Determine if the timer is on active timer list.  */
+        else if (active_timer_list == TX_TRUE)
+#else
+
         /* Determine if the timer is on active timer list.  */
         if (active_timer_list == TX_TRUE)
+#endif
         {
 
             /* This timer is active and has not yet expired.  */
@@ -61,7 +61,8 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _tx_timer_wheel_boundary_get      Ticks to the next wheel timer     */
+/*                                        expiration                      */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -140,8 +141,24 @@ UINT                active_timer_list;
             }
         }
 
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+
+        /* Determine if the timer is on the timing wheel.  */
+        if ((internal_ptr -> tx_timer_internal_list_head >= &_tx_timer_wheel[0]) &&
+            (internal_ptr -> tx_timer_internal_list_head < &_tx_timer_wheel[TX_TIMER_WHEEL_SLOTS]))
+        {
+
+            /* Convert the expiration time on the wheel to the ticks left.  */
+            ticks_left =  (internal_ptr -> tx_timer_internal_remaining_ticks - _tx_timer_wheel_time) + _tx_timer_wheel_boundary_get();
+        }
+
+        /* Determine if the timer is on the active timer list.  */
+        else if (active_timer_list == TX_TRUE)
+#else
+
         /* Determine if the timer is on the active timer list.  */
         if (active_timer_list == TX_TRUE)
+#endif
         {
 
             /* Calculate the amount of time that has elapsed since the timer
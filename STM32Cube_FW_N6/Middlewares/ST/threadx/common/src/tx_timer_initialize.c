@@ -88,6 +88,26 @@ ULONG               _tx_timer_created_count;
 TX_TIMER_INTERNAL  *_tx_timer_expired_timer_ptr;
 
 
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+
+/* Define the slots of the timing wheel levels, level after level.  */
+
+TX_TIMER_INTERNAL   *_tx_timer_wheel[TX_TIMER_WHEEL_SLOTS];
+
+
+/* Define the internal timer that moves the timers down the wheel.  */
+
+TX_TIMER            _tx_timer_wheel_timer;
+
+
+/* Define the time of the next expiration of the wheel timer, a multiple of
+   TX_TIMER_ENTRIES in the time base of the wheel expiration times.  */
+
+ULONG               _tx_timer_wheel_time;
+
+#endif
+
+
 #ifndef TX_TIMER_PROCESS_IN_ISR
 
 /* Define the timer thread's control block.  */
@@ -228,6 +248,21 @@ UINT    status;
 
     /* First, initialize the timer list.  */
     TX_MEMSET(&_tx_timer_list[0], 0, (sizeof(_tx_timer_list)));
+
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+
+    /* Initialize the timing wheel and its timer.  */
+    TX_MEMSET(&_tx_timer_wheel[0], 0, (sizeof(_tx_timer_wheel)));
+    TX_MEMSET(&_tx_timer_wheel_timer, 0, (sizeof(TX_TIMER)));
+    _tx_timer_wheel_time =  ((ULONG) 0);
+#endif
+#endif
+
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+
+    /* Setup the expiration function of the wheel timer. It is not a created application
+       timer and is only active while timers are on the wheel.  */
+    _tx_timer_wheel_timer.tx_timer_internal.tx_timer_internal_timeout_function =  _tx_timer_wheel_cascade;
 #endif
 
     /* Initialize all of the list pointers.  */
@@ -56,7 +56,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _tx_timer_wheel_insert            Timing wheel insertion            */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -104,6 +104,20 @@ ULONG                       expiration_time;
             if (timer_ptr -> tx_timer_internal_list_head == TX_NULL)
             {
 
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+
+                /* Determine if the timer must be placed on the timing wheel.  */
+                if (remaining_ticks > TX_TIMER_ENTRIES)
+                {
+
+                    /* Place the timer on the timing wheel.  */
+                    _tx_timer_wheel_insert(timer_ptr);
+
+                    /* Done with this timer.  */
+                    return;
+                }
+#endif
+
                 /* Activate the timer.  */
 
                 /* Calculate the amount of time remaining for the timer.  */
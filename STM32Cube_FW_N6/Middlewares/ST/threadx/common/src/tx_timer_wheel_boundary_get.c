@@ -0,0 +1,135 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_wheel_boundary_get                        PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the number of ticks until the next expiration */
+/*    of the wheel timer, which happens at _tx_timer_wheel_time in the    */
+/*    time base of the wheel. Zero is returned if the wheel timer is      */
+/*    expiring in the timer list slot being processed, and                */
+/*    TX_TIMER_ENTRIES if the wheel timer is not active.                  */
+/*                                                                        */
+/*    This function must be called with interrupts disabled.              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    ticks                             Ticks to the next wheel timer     */
+/*                                        expiration                      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_timer_deactivate              Timer deactivate function         */
+/*    _tx_timer_info_get                Timer information retrieval       */
+/*    _tx_timer_wheel_insert            Timing wheel insertion            */
+/*    _tx_timer_wheel_next_get          Timing wheel next expiration      */
+/*    tx_time_increment                 Low power time adjustment         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+ULONG  _tx_timer_wheel_boundary_get(VOID)
+{
+
+TX_TIMER_INTERNAL   **list_head;
+ULONG               ticks;
+
+
+    /* Pickup the list head of the wheel timer.  */
+    list_head =  _tx_timer_wheel_timer.tx_timer_internal.tx_timer_internal_list_head;
+
+    /* Default to a wheel timer expiring in the slot being processed, either on the
+       expired list or with its expiration function about to run.  */
+    ticks =  ((ULONG) 0);
+
+    /* Determine if the wheel timer is on the timer list.  */
+    if (list_head == TX_NULL)
+    {
+
+        /* Determine if the wheel timer is inactive.  */
+        if (_tx_timer_expired_timer_ptr != &(_tx_timer_wheel_timer.tx_timer_internal))
+        {
+
+            /* The wheel timer is started a full timer list from now.  */
+            ticks =  TX_TIMER_ENTRIES;
+        }
+    }
+    else if (TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(list_head) >= TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(_tx_timer_list_start))
+    {
+
+        /* Now check to make sure the list head is before the end of the list.  */
+        if (TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(list_head) < TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(_tx_timer_list_end))
+        {
+
+            /* Is the wheel timer's entry after the current timer pointer?  */
+            if (TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(list_head) >= TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(_tx_timer_current_ptr))
+            {
+
+                /* Calculate ticks left to expiration - just the difference between this
+                   timer's entry and the current timer pointer.  */
+                ticks =  (ULONG) (TX_TIMER_POINTER_DIF(list_head, _tx_timer_current_ptr)) + ((ULONG) 1);
+            }
+            else
+            {
+
+                /* Calculate the ticks left with a wrapped list condition.  */
+                ticks =  (ULONG) (TX_TIMER_POINTER_DIF(list_head, _tx_timer_list_start));
+                ticks =  ticks + (ULONG) ((TX_TIMER_POINTER_DIF(_tx_timer_list_end, _tx_timer_current_ptr)) + ((ULONG) 1));
+            }
+        }
+    }
+
+    /* Return the ticks to the next wheel timer expiration.  */
+    return(ticks);
+}
+#endif
@@ -0,0 +1,198 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_timer.h"
+#include "tx_thread.h"
+
+
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_wheel_cascade                             PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is the expiration function of the wheel timer. It    */
+/*    restarts the wheel timer, then moves the timers of the level 0      */
+/*    slot that is due, and of the slots of the upper levels whose turn   */
+/*    starts, to the timer list or to a lower level. The wheel timer is   */
+/*    stopped once the wheel is empty.                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    timer_input                       Not used                          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_timer_system_activate         Timer activate function           */
+/*    _tx_timer_system_deactivate       Timer deactivate function         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_timer_thread_entry            Timer thread processing           */
+/*    _tx_timer_expiration_process      Timer expiration processing       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_timer_wheel_cascade(ULONG timer_input)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_TIMER_INTERNAL           **timer_list;
+TX_TIMER_INTERNAL           *current_timer;
+TX_TIMER_INTERNAL           *next_timer;
+TX_TIMER_INTERNAL           *wheel_timer;
+ULONG                       wheel_time;
+ULONG                       wheel_expirations;
+ULONG                       slot;
+UINT                        level;
+#ifdef TX_TIMER_ENABLE_PERFORMANCE_INFO
+TX_TIMER                    *timer_ptr;
+#endif
+
+
+    /* Not used.  */
+    TX_PARAMETER_NOT_USED(timer_input);
+
+    /* Disable interrupts while the wheel is updated.  */
+    TX_DISABLE
+
+    /* Restart the wheel timer for the next turn of the timer list.  */
+    wheel_timer =  &(_tx_timer_wheel_timer.tx_timer_internal);
+    wheel_timer -> tx_timer_internal_remaining_ticks =  TX_TIMER_ENTRIES;
+    _tx_timer_system_activate(wheel_timer);
+
+    /* Pickup the time of this expiration and move to the next one.  */
+    wheel_time =  _tx_timer_wheel_time;
+    _tx_timer_wheel_time =  wheel_time + TX_TIMER_ENTRIES;
+    wheel_expirations =  wheel_time >> TX_TIMER_WHEEL_SHIFT;
+
+    /* Move the timers of the due slots, starting with level 0. A slot of an upper level
+       is due when the turn of the level below starts.  */
+    level =  ((UINT) 0);
+    do
+    {
+
+        /* Pickup the due slot of this level and detach its timers.  */
+        slot =        (wheel_expirations >> (TX_TIMER_WHEEL_SHIFT * level)) & (TX_TIMER_ENTRIES - ((ULONG) 1));
+        timer_list =  &_tx_timer_wheel[(((ULONG) level) * TX_TIMER_ENTRIES) + slot];
+        current_timer =  *timer_list;
+        *timer_list =  TX_NULL;
+
+        /* Determine if there are timers in this slot.  */
+        if (current_timer != TX_NULL)
+        {
+
+            /* NULL terminate the detached list.  */
+            (current_timer -> tx_timer_internal_active_previous) -> tx_timer_internal_active_next =  TX_NULL;
+
+            /* Place each timer again from its expiration time.  */
+            do
+            {
+
+                /* Pickup the next timer.  */
+                next_timer =  current_timer -> tx_timer_internal_active_next;
+
+#ifdef TX_TIMER_ENABLE_PERFORMANCE_INFO
+
+                /* Increment the total expiration adjustments counter.  */
+                _tx_timer_performance__expiration_adjust_count++;
+
+                /* Determine if this is an application timer.  */
+                if (current_timer -> tx_timer_internal_timeout_function != &_tx_thread_timeout)
+                {
+
+                    /* Pickup the application timer pointer.  */
+                    TX_USER_TIMER_POINTER_GET(current_timer, timer_ptr)
+
+                    /* Increment the number of expiration adjustments on this timer.  */
+                    if (timer_ptr -> tx_timer_id == TX_TIMER_ID)
+                    {
+
+                        timer_ptr -> tx_timer_performance__expiration_adjust_count++;
+                    }
+                }
+#endif
+
+                /* Convert the expiration time to the ticks left from this expiration, which
+                   go to the timer list or back to the wheel.  */
+                current_timer -> tx_timer_internal_remaining_ticks =  current_timer -> tx_timer_internal_remaining_ticks - wheel_time;
+                current_timer -> tx_timer_internal_list_head =  TX_NULL;
+                _tx_timer_system_activate(current_timer);
+
+                /* Move to the next timer.  */
+                current_timer =  next_timer;
+
+            } while (current_timer != TX_NULL);
+        }
+
+        /* Move to the next level.  */
+        level++;
+
+    } while ((level < ((UINT) TX_TIMER_WHEEL_LEVELS)) &&
+             ((wheel_expirations & ((((ULONG) 1) << (TX_TIMER_WHEEL_SHIFT * level)) - ((ULONG) 1))) == ((ULONG) 0)));
+
+    /* Determine if there is any timer left on the wheel.  */
+    for (slot = ((ULONG) 0); slot < TX_TIMER_WHEEL_SLOTS; slot++)
+    {
+
+        /* Stop at the first timer.  */
+        if (_tx_timer_wheel[slot] != TX_NULL)
+        {
+
+            break;
+        }
+    }
+
+    /* Stop the wheel timer if the wheel is empty.  */
+    if (slot == TX_TIMER_WHEEL_SLOTS)
+    {
+
+        _tx_timer_system_deactivate(wheel_timer);
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+}
+#endif
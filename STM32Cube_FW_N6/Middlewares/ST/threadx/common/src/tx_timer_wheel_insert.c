@@ -0,0 +1,172 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_wheel_insert                              PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places a timer whose remaining ticks do not fit in    */
+/*    the timer list on the timing wheel. The remaining ticks are         */
+/*    replaced by the absolute expiration time in the time base of the    */
+/*    wheel, and the timer is put on the slot of the lowest level that    */
+/*    covers the expiration. The wheel timer is started if it is not      */
+/*    active.                                                             */
+/*                                                                        */
+/*    This function must be called with interrupts disabled.              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    timer_ptr                         Pointer to timer                  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_timer_system_activate         Timer activate function           */
+/*    _tx_timer_wheel_boundary_get      Ticks to the next wheel timer     */
+/*                                        expiration                      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_timer_system_activate         Timer activate function           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_timer_wheel_insert(TX_TIMER_INTERNAL *timer_ptr)
+{
+
+TX_TIMER_INTERNAL           **timer_list;
+TX_TIMER_INTERNAL           *next_timer;
+TX_TIMER_INTERNAL           *previous_timer;
+TX_TIMER_INTERNAL           *wheel_timer;
+ULONG                       expiration_time;
+ULONG                       delta;
+ULONG                       slot;
+UINT                        level;
+
+
+    /* Pickup the wheel timer.  */
+    wheel_timer =  &(_tx_timer_wheel_timer.tx_timer_internal);
+
+    /* Determine if the wheel timer is inactive, which is the case when the wheel is empty.  */
+    if (wheel_timer -> tx_timer_internal_list_head == TX_NULL)
+    {
+
+        /* Make sure the wheel timer is not expiring right now.  */
+        if (_tx_timer_expired_timer_ptr != wheel_timer)
+        {
+
+            /* Start the wheel timer a full timer list from now.  */
+            wheel_timer -> tx_timer_internal_remaining_ticks =  TX_TIMER_ENTRIES;
+            _tx_timer_system_activate(wheel_timer);
+        }
+    }
+
+    /* Calculate the ticks past the next wheel timer expiration, at least one since the
+       timer does not fit in the timer list.  */
+    delta =  timer_ptr -> tx_timer_internal_remaining_ticks - _tx_timer_wheel_boundary_get();
+
+    /* Save the expiration time in the remaining ticks.  */
+    expiration_time =  _tx_timer_wheel_time + delta;
+    timer_ptr -> tx_timer_internal_remaining_ticks =  expiration_time;
+
+    /* Calculate the number of wheel timer expirations after the next one at which the
+       timer gets in the range of the timer list.  */
+    delta =  (delta - ((ULONG) 1)) >> TX_TIMER_WHEEL_SHIFT;
+
+    /* Find the lowest level that covers this number of expirations.  */
+    level =  ((UINT) 0);
+    while ((level < (((UINT) TX_TIMER_WHEEL_LEVELS) - ((UINT) 1))) &&
+           ((delta >> (TX_TIMER_WHEEL_SHIFT * (level + ((UINT) 1)))) != ((ULONG) 0)))
+    {
+
+        /* Move to the next level.  */
+        level++;
+    }
+
+    /* Determine if the expiration is beyond the last level.  */
+    if ((delta >> (TX_TIMER_WHEEL_SHIFT * (level + ((UINT) 1)))) != ((ULONG) 0))
+    {
+
+        /* Place the timer on the last slot covered by the wheel. It is placed
+           again when this slot is moved down.  */
+        delta =  (((ULONG) 1) << (TX_TIMER_WHEEL_SHIFT * (level + ((UINT) 1)))) - ((ULONG) 1);
+    }
+
+    /* Calculate the slot of the timer on its level.  */
+    slot =  (((_tx_timer_wheel_time >> TX_TIMER_WHEEL_SHIFT) + delta) >> (TX_TIMER_WHEEL_SHIFT * level)) & (TX_TIMER_ENTRIES - ((ULONG) 1));
+    timer_list =  &_tx_timer_wheel[(((ULONG) level) * TX_TIMER_ENTRIES) + slot];
+
+    /* Now put the timer on this list.  */
+    if ((*timer_list) == TX_NULL)
+    {
+
+        /* This list is NULL, just put the new timer on it.  */
+
+        /* Setup the links in this timer.  */
+        timer_ptr -> tx_timer_internal_active_next =      timer_ptr;
+        timer_ptr -> tx_timer_internal_active_previous =  timer_ptr;
+
+        /* Setup the list head pointer.  */
+        *timer_list =  timer_ptr;
+    }
+    else
+    {
+
+        /* This list is not NULL, add current timer to the end. */
+        next_timer =                                        *timer_list;
+        previous_timer =                                    next_timer -> tx_timer_internal_active_previous;
+        previous_timer -> tx_timer_internal_active_next =   timer_ptr;
+        next_timer -> tx_timer_internal_active_previous =   timer_ptr;
+        timer_ptr -> tx_timer_internal_active_next =        next_timer;
+        timer_ptr -> tx_timer_internal_active_previous =    previous_timer;
+    }
+
+    /* Setup list head pointer.  */
+    timer_ptr -> tx_timer_internal_list_head =  timer_list;
+}
+#endif
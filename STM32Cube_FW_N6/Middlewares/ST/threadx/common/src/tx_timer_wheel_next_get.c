@@ -0,0 +1,158 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_wheel_next_get                            PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the number of ticks until the first           */
+/*    expiration of the timers on the timing wheel. On each level, only   */
+/*    the first non-empty slot in expiration order is examined, since     */
+/*    the timers of the following slots of the same level expire later.  */
+/*                                                                        */
+/*    This function must be called with interrupts disabled.              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    next_ticks_ptr                    Pointer to destination for the    */
+/*                                        ticks to the first expiration   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_TRUE                           A timer is on the wheel           */
+/*    TX_FALSE                          The wheel is empty                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_timer_wheel_boundary_get      Ticks to the next wheel timer     */
+/*                                        expiration                      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    tx_timer_get_next                 Low power next expiration         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_timer_wheel_next_get(ULONG *next_ticks_ptr)
+{
+
+TX_TIMER_INTERNAL           **timer_list;
+TX_TIMER_INTERNAL           *next_timer;
+ULONG                       wheel_expirations;
+ULONG                       level_expirations;
+ULONG                       slot;
+ULONG                       i;
+ULONG                       calculated_time;
+ULONG                       expiration_time =  ((ULONG) 0xFFFFFFFF);
+UINT                        level;
+UINT                        status =  TX_FALSE;
+
+
+    /* Pickup the number of the next wheel timer expiration.  */
+    wheel_expirations =  _tx_timer_wheel_time >> TX_TIMER_WHEEL_SHIFT;
+
+    /* Look at each level.  */
+    for (level = ((UINT) 0); level < ((UINT) TX_TIMER_WHEEL_LEVELS); level++)
+    {
+
+        /* Calculate the first slot of this level that has not been moved down yet, the
+           current slot only if its turn starts at the next wheel timer expiration.  */
+        level_expirations =  (((ULONG) 1) << (TX_TIMER_WHEEL_SHIFT * level)) - ((ULONG) 1);
+        slot =  ((wheel_expirations + level_expirations) >> (TX_TIMER_WHEEL_SHIFT * level)) & (TX_TIMER_ENTRIES - ((ULONG) 1));
+
+        /* Loop to find the first non-empty slot.  */
+        for (i = ((ULONG) 0); i < TX_TIMER_ENTRIES; i++)
+        {
+
+            /* Pickup the slot.  */
+            timer_list =  &_tx_timer_wheel[(((ULONG) level) * TX_TIMER_ENTRIES) + ((slot + i) & (TX_TIMER_ENTRIES - ((ULONG) 1)))];
+
+            /* Determine if there is an active timer in this slot.  */
+            if (*timer_list != TX_NULL)
+            {
+
+                /* Setup the pointer to the expiration list.  */
+                next_timer =  *timer_list;
+
+                /* Loop through the timers of this slot, which may also hold timers of the
+                   next turn of the level.  */
+                do
+                {
+
+                    /* Calculate the expiration time relative to the next wheel timer expiration.  */
+                    calculated_time =  next_timer -> tx_timer_internal_remaining_ticks - _tx_timer_wheel_time;
+
+                    /* Determine if a new minimum expiration time is present.  */
+                    if (expiration_time > calculated_time)
+                    {
+
+                        /* Yes, a new minimum expiration time is present - remember it!  */
+                        expiration_time =  calculated_time;
+                    }
+
+                    /* Move to the next entry in the timer list.  */
+                    next_timer =  next_timer -> tx_timer_internal_active_next;
+
+                } while (next_timer != *timer_list);
+
+                /* The following slots of this level expire later.  */
+                status =  TX_TRUE;
+                break;
+            }
+        }
+    }
+
+    /* Determine if a timer was found.  */
+    if (status == TX_TRUE)
+    {
+
+        /* Return the ticks to the first expiration.  */
+        *next_ticks_ptr =  expiration_time + _tx_timer_wheel_boundary_get();
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+#endif
@@ -351,6 +351,17 @@ ULONG   _tx_misra_time_stamp_get(VOID);
 #define TX_TRACE_PORT_EXTENSION                 clock_gettime(CLOCK_REALTIME, &_tx_linux_time_stamp);
 
 
+/* Define the time source of the execution profile kit, the monotonic clock in nanoseconds
+   truncated to 32 bits.  */
+
+#if defined(TX_ENABLE_EXECUTION_CHANGE_NOTIFY) || defined(TX_EXECUTION_PROFILE_ENABLE)
+ULONG   _tx_linux_execution_time_get(VOID);
+#ifndef TX_EXECUTION_TIME_SOURCE
+#define TX_EXECUTION_TIME_SOURCE                ((EXECUTION_TIME_SOURCE_TYPE) _tx_linux_execution_time_get())
+#endif
+#endif
+
+
 /* Define the port specific options for the _tx_build_options variable. This variable indicates
    how the ThreadX library was built.  */
 
@@ -153,6 +153,21 @@ pthread_mutex_t        temp_copy;
 #endif
 
 
+#if defined(TX_ENABLE_EXECUTION_CHANGE_NOTIFY) || defined(TX_EXECUTION_PROFILE_ENABLE)
+
+/* Define the time source of the execution profile kit.  */
+ULONG   _tx_linux_execution_time_get(VOID)
+{
+struct timespec time_stamp;
+
+    /* Pickup the monotonic time, in nanoseconds truncated to 32 bits.  */
+    clock_gettime(CLOCK_MONOTONIC, &time_stamp);
+    return((ULONG) ((((unsigned long long) time_stamp.tv_sec) * 1000000000ULL) + ((unsigned long long) time_stamp.tv_nsec)));
+}
+
+#endif
+
+
 /* Define the ThreadX timer interrupt handler.  */
 
 void    _tx_timer_interrupt(void);
@@ -32,6 +32,10 @@
 
 extern sem_t _tx_linux_isr_semaphore;
 UINT _tx_linux_timer_waiting = 0;
+
+#if defined(TX_ENABLE_EXECUTION_CHANGE_NOTIFY) || defined(TX_EXECUTION_PROFILE_ENABLE)
+extern VOID _tx_execution_isr_exit(VOID);
+#endif
 /**************************************************************************/ 
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
@@ -66,6 +70,7 @@ UINT _tx_linux_timer_waiting = 0;
 /*    tx_linux_sem_wait                                                   */ 
 /*    _tx_linux_thread_resume                                             */ 
 /*    tx_linux_mutex_recursive_unlock                                     */ 
+/*    [_tx_execution_isr_exit]                                            */
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -88,6 +93,12 @@ VOID   _tx_thread_context_restore(VOID)
        the core ThreadX data structures.  */
     tx_linux_mutex_lock(_tx_linux_mutex);
 
+#if defined(TX_ENABLE_EXECUTION_CHANGE_NOTIFY) || defined(TX_EXECUTION_PROFILE_ENABLE)
+
+    /* Call the ISR exit function to indicate an ISR is complete.  */
+    _tx_execution_isr_exit();
+#endif
+
     /* Decrement the nested interrupt count.  */
     _tx_thread_system_state--;
 
@@ -30,6 +30,10 @@
 #include "tx_thread.h"
 #include "tx_timer.h"
 
+#if defined(TX_ENABLE_EXECUTION_CHANGE_NOTIFY) || defined(TX_EXECUTION_PROFILE_ENABLE)
+extern VOID _tx_execution_isr_enter(VOID);
+#endif
+
 
 /**************************************************************************/ 
 /*                                                                        */ 
@@ -61,6 +65,7 @@
 /*    tx_linux_mutex_lock                                                 */ 
 /*    _tx_linux_thread_suspend                                            */ 
 /*    tx_linux_mutex_unlock                                               */ 
+/*    [_tx_execution_isr_enter]                                           */
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -101,6 +106,12 @@ VOID   _tx_thread_context_save(VOID)
     /* Increment the nested interrupt condition.  */
     _tx_thread_system_state++;
 
+#if defined(TX_ENABLE_EXECUTION_CHANGE_NOTIFY) || defined(TX_EXECUTION_PROFILE_ENABLE)
+
+    /* Call the ISR enter function to indicate an ISR is executing.  */
+    _tx_execution_isr_enter();
+#endif
+
     /* Unlock linux mutex. */
     tx_linux_mutex_unlock(_tx_linux_mutex);
 }
@@ -36,6 +36,10 @@ extern sem_t _tx_linux_timer_semaphore;
 extern sem_t _tx_linux_isr_semaphore;
 extern UINT _tx_linux_timer_waiting;
 extern pthread_t _tx_linux_timer_id;
+
+#if defined(TX_ENABLE_EXECUTION_CHANGE_NOTIFY) || defined(TX_EXECUTION_PROFILE_ENABLE)
+extern VOID _tx_execution_thread_enter(VOID);
+#endif
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
@@ -69,6 +73,7 @@ extern pthread_t _tx_linux_timer_id;
 /*    tx_linux_sem_post                                                   */
 /*    sem_trywait                                                         */
 /*    tx_linux_sem_wait                                                   */
+/*    [_tx_execution_thread_enter]                                        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -146,6 +151,12 @@ struct timespec ts;
         /* Setup time-slice, if present.  */
         _tx_timer_time_slice =  _tx_thread_current_ptr -> tx_thread_time_slice;
 
+#if defined(TX_ENABLE_EXECUTION_CHANGE_NOTIFY) || defined(TX_EXECUTION_PROFILE_ENABLE)
+
+        /* Call the thread entry function to indicate the thread is executing.  */
+        _tx_execution_thread_enter();
+#endif
+
         /* Determine how the thread was suspended.  */
         if (_tx_thread_current_ptr -> tx_thread_linux_suspension_type)
         {
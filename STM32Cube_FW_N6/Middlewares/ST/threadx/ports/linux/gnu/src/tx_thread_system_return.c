@@ -30,6 +30,10 @@
 #include "tx_timer.h"
 #include <stdio.h>
 
+#if defined(TX_ENABLE_EXECUTION_CHANGE_NOTIFY) || defined(TX_EXECUTION_PROFILE_ENABLE)
+extern VOID _tx_execution_thread_exit(VOID);
+#endif
+
 
 /**************************************************************************/ 
 /*                                                                        */ 
@@ -69,6 +73,7 @@
 /*    tx_linux_sem_post                                                   */ 
 /*    sem_trywait                                                         */
 /*    tx_linux_sem_wait                                                   */ 
+/*    [_tx_execution_thread_exit]                                         */
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -136,6 +141,12 @@ int         exit_code = 0;
     /* Setup the suspension type for this thread.  */
     temp_thread_ptr -> tx_thread_linux_suspension_type  =  0;
 
+#if defined(TX_ENABLE_EXECUTION_CHANGE_NOTIFY) || defined(TX_EXECUTION_PROFILE_ENABLE)
+
+    /* Call the thread exit function to indicate the thread is no longer executing.  */
+    _tx_execution_thread_exit();
+#endif
+
     /* Set the current thread pointer to NULL.  */
     _tx_thread_current_ptr =  TX_NULL;
 
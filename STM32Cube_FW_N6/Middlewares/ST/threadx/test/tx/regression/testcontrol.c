@@ -132,6 +132,7 @@ void    threadx_block_memory_suspension_timeout_application_define(void *);
 void    threadx_block_memory_thread_terminate_application_define(void *);
 void    threadx_block_memory_prioritize_application_define(void *);
 void    threadx_block_memory_information_application_define(void *);
+void    threadx_block_memory_thread_cache_application_define(void *);
 
 void    threadx_byte_memory_basic_application_define(void *);
 void    threadx_byte_memory_thread_contention_application_define(void *);
@@ -140,6 +141,7 @@ void    threadx_byte_memory_suspension_timeout_application_define(void *);
 void    threadx_byte_memory_thread_terminate_application_define(void *);
 void    threadx_byte_memory_prioritize_application_define(void *);
 void    threadx_byte_memory_information_application_define(void *);
+void    threadx_byte_memory_fragmentation_application_define(void *);
 
 void    threadx_event_flag_basic_application_define(void *);
 void    threadx_event_flag_suspension_application_define(void *);
@@ -153,7 +155,10 @@ void    threadx_event_flag_isr_set_clear_application_define(void *);
 void    threadx_event_flag_isr_wait_abort_application_define(void *);
 void    threadx_event_flag_information_application_define(void *);
 
+void    threadx_execution_profile_application_define(void *);
+
 void    threadx_interrupt_control_application_define(void *);
+void    threadx_job_pool_application_define(void *);
 
 void    threadx_mutex_basic_application_define(void *);
 void    threadx_mutex_delete_application_define(void *);
@@ -180,6 +185,7 @@ void    threadx_queue_flush_no_suspension_application_define(void *);
 void    threadx_queue_front_send_application_define(void *);
 void    threadx_queue_prioritize_application_define(void *);
 void    threadx_queue_information_application_define(void *);
+void    threadx_queue_pointer_application_define(void *);
 
 void    threadx_semaphore_basic_application_define(void *);
 void    threadx_semaphore_delete_application_define(void *);
@@ -227,6 +233,7 @@ void    threadx_timer_large_timer_accuracy_application_define(void *);
 void    threadx_timer_multiple_application_define(void *);
 void    threadx_timer_multiple_accuracy_application_define(void *);
 void    threadx_timer_information_application_define(void *);
+void    threadx_timer_wheel_application_define(void *);
 
 void    threadx_trace_basic_application_define(void *);
 void    test_application_define(void *first_unused_memory);
@@ -248,6 +255,7 @@ TEST_ENTRY  test_control_tests[] =
     threadx_block_memory_suspension_timeout_application_define,
     threadx_block_memory_thread_terminate_application_define,
     threadx_block_memory_information_application_define,
+    threadx_block_memory_thread_cache_application_define,
 
     threadx_byte_memory_basic_application_define,
     threadx_byte_memory_suspension_application_define,
@@ -256,6 +264,7 @@ TEST_ENTRY  test_control_tests[] =
     threadx_byte_memory_prioritize_application_define,
     threadx_byte_memory_thread_contention_application_define,
     threadx_byte_memory_information_application_define, 
+    threadx_byte_memory_fragmentation_application_define,
 
     threadx_event_flag_basic_application_define,
     threadx_event_flag_suspension_application_define,
@@ -269,7 +278,10 @@ TEST_ENTRY  test_control_tests[] =
     threadx_event_flag_isr_wait_abort_application_define,
     threadx_event_flag_information_application_define,
 
+    threadx_execution_profile_application_define,
+
     threadx_interrupt_control_application_define,
+    threadx_job_pool_application_define,
 
     threadx_mutex_basic_application_define,
     threadx_mutex_delete_application_define,
@@ -296,6 +308,7 @@ TEST_ENTRY  test_control_tests[] =
     threadx_queue_front_send_application_define,
     threadx_queue_prioritize_application_define,
     threadx_queue_information_application_define,
+    threadx_queue_pointer_application_define,
 
     threadx_semaphore_basic_application_define,
     threadx_semaphore_delete_application_define,
@@ -345,6 +358,7 @@ TEST_ENTRY  test_control_tests[] =
     threadx_timer_multiple_application_define,
     threadx_timer_multiple_accuracy_application_define,
     threadx_timer_information_application_define, 
+    threadx_timer_wheel_application_define,
 
     threadx_trace_basic_application_define,
 #endif
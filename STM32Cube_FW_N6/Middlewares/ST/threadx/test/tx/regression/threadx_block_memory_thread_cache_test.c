@@ -0,0 +1,427 @@
+/* This test is designed to test block memory allocation and release through the block
+   caches of the threads (TX_BLOCK_POOL_ENABLE_THREAD_CACHE): refill and flush bounds,
+   hand-off of released blocks to suspended threads, flush of a deleted thread and of a
+   cache moving to another pool, pool delete and performance information. Without the
+   cache, only the pool behavior is checked. The allocate and release latency of a thread
+   working set is reported so that both builds can be compared.  */
+
+#include   <stdio.h>
+#include   "tx_api.h"
+#include   "tx_block_pool.h"
+
+
+#define TEST_BLOCK_SIZE         64
+#define TEST_BLOCKS             32
+#define TEST_WORKING_SET        6
+#define TEST_CYCLES             20000
+
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+#define TEST_CACHE_SIZE         TX_BLOCK_POOL_THREAD_CACHE_SIZE
+#else
+#define TEST_CACHE_SIZE         0
+#endif
+
+
+static TX_THREAD       thread_0;
+static TX_THREAD       thread_1;
+static TX_THREAD       thread_2;
+
+static unsigned long   thread_1_counter =  0;
+static UCHAR           *thread_1_blocks[4];
+
+static TX_BLOCK_POOL   pool_0;
+static TX_BLOCK_POOL   pool_1;
+static ALIGN_TYPE      pool_0_area[(TEST_BLOCKS * (TEST_BLOCK_SIZE + sizeof(UCHAR *))) / sizeof(ALIGN_TYPE)];
+static ALIGN_TYPE      pool_1_area[(4 * (TEST_BLOCK_SIZE + sizeof(UCHAR *))) / sizeof(ALIGN_TYPE)];
+
+static UCHAR           *blocks[TEST_BLOCKS];
+
+
+/* Define thread prototypes.  */
+
+static void    thread_0_entry(ULONG thread_input);
+static void    thread_1_entry(ULONG thread_input);
+static void    thread_2_entry(ULONG thread_input);
+
+
+/* Prototype for test control return.  */
+void  test_control_return(UINT status);
+
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+void test_application_define(void *first_unused_memory)
+#else
+void    threadx_block_memory_thread_cache_application_define(void *first_unused_memory)
+#endif
+{
+
+UINT    status;
+CHAR    *pointer;
+
+
+    /* Put first available memory address into a character pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    /* Put system definition stuff in here, e.g. thread creates and other assorted
+       create information.  */
+
+    status =  tx_thread_create(&thread_0, "thread 0", thread_0_entry, 1,
+            pointer, TEST_STACK_SIZE_PRINTF,
+            16, 16, 100, TX_AUTO_START);
+    pointer = pointer + TEST_STACK_SIZE_PRINTF;
+
+    status += tx_thread_create(&thread_1, "thread 1", thread_1_entry, 1,
+            pointer, TEST_STACK_SIZE_PRINTF,
+            15, 15, 100, TX_DONT_START);
+    pointer = pointer + TEST_STACK_SIZE_PRINTF;
+
+    status += tx_thread_create(&thread_2, "thread 2", thread_2_entry, 1,
+            pointer, TEST_STACK_SIZE_PRINTF,
+            17, 17, 100, TX_DONT_START);
+    pointer = pointer + TEST_STACK_SIZE_PRINTF;
+
+    /* Create the block pools outside of the test memory area.  */
+    status += tx_block_pool_create(&pool_0, "pool 0", TEST_BLOCK_SIZE, pool_0_area, sizeof(pool_0_area));
+    status += tx_block_pool_create(&pool_1, "pool 1", TEST_BLOCK_SIZE, pool_1_area, sizeof(pool_1_area));
+
+    /* Check status.  */
+    if ((status != TX_SUCCESS) || (pool_0.tx_block_pool_total != TEST_BLOCKS))
+    {
+
+        printf("Running Block Memory Thread Cache Test.............................. ERROR #1\n");
+        test_control_return(1);
+    }
+}
+
+
+static ULONG   time_get(void)
+{
+
+struct timespec ts;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return((ULONG) (((ULONG) ts.tv_sec * 1000000000UL) + (ULONG) ts.tv_nsec));
+}
+
+
+/* Return the number of blocks cached by a thread.  */
+
+static UINT    cached_get(TX_THREAD *thread_ptr)
+{
+
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+    return(thread_ptr -> tx_thread_block_cache_count);
+#else
+    (void) thread_ptr;
+    return(0);
+#endif
+}
+
+
+/* Define the test threads.  */
+
+static void    thread_0_entry(ULONG thread_input)
+{
+
+UINT    status;
+ULONG   cycle;
+ULONG   start;
+ULONG   elapsed;
+UINT    j;
+UINT    k;
+UINT    count;
+UCHAR   *pointer;
+#ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
+ULONG   allocates;
+ULONG   releases;
+#endif
+
+
+    /* Inform user.  */
+    printf("Running Block Memory Thread Cache Test.............................. ");
+
+    /* Allocate one block.  */
+    status =  tx_block_allocate(&pool_0, (VOID **) &blocks[0], TX_NO_WAIT);
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+
+    /* The cache is refilled with TX_BLOCK_POOL_THREAD_CACHE_REFILL blocks.  */
+    if ((status != TX_SUCCESS) || (thread_0.tx_thread_block_cache_pool != &pool_0) ||
+        (pool_0.tx_block_pool_available != (TEST_BLOCKS - TX_BLOCK_POOL_THREAD_CACHE_REFILL)) ||
+        (cached_get(&thread_0) != (TX_BLOCK_POOL_THREAD_CACHE_REFILL - 1)))
+#else
+    if ((status != TX_SUCCESS) || (pool_0.tx_block_pool_available != (TEST_BLOCKS - 1)))
+#endif
+    {
+
+        /* Block memory error.  */
+        printf("ERROR #2\n");
+        test_control_return(1);
+    }
+
+    /* Release it.  */
+    status =  tx_block_release(blocks[0]);
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+    if ((status != TX_SUCCESS) || (pool_0.tx_block_pool_available != (TEST_BLOCKS - TX_BLOCK_POOL_THREAD_CACHE_REFILL)) ||
+        (cached_get(&thread_0) != TX_BLOCK_POOL_THREAD_CACHE_REFILL))
+#else
+    if ((status != TX_SUCCESS) || (pool_0.tx_block_pool_available != TEST_BLOCKS))
+#endif
+    {
+
+        /* Block memory error.  */
+        printf("ERROR #3\n");
+        test_control_return(1);
+    }
+
+    /* Allocate and release a working set of blocks, checking their content.  */
+    elapsed =  0;
+    for (cycle = 0; cycle < TEST_CYCLES; cycle++)
+    {
+
+        count =  (UINT) (1 + (cycle % TEST_WORKING_SET));
+        start =  time_get();
+        for (j = 0; j < count; j++)
+        {
+
+            status =  tx_block_allocate(&pool_0, (VOID **) &blocks[j], TX_NO_WAIT);
+            if (status != TX_SUCCESS)
+            {
+
+                /* Block memory error.  */
+                printf("ERROR #4\n");
+                test_control_return(1);
+            }
+        }
+        elapsed +=  time_get() - start;
+
+        for (j = 0; j < count; j++)
+        {
+
+            for (k = 0; k < TEST_BLOCK_SIZE; k++)
+                blocks[j][k] =  (UCHAR) (j + cycle);
+        }
+        for (j = 0; j < count; j++)
+        {
+
+            for (k = 0; k < TEST_BLOCK_SIZE; k++)
+            {
+
+                if (blocks[j][k] != (UCHAR) (j + cycle))
+                {
+
+                    /* Block memory error.  */
+                    printf("ERROR #5\n");
+                    test_control_return(1);
+                }
+            }
+        }
+
+        start =  time_get();
+        for (j = 0; j < count; j++)
+        {
+
+            status =  tx_block_release(blocks[j]);
+            if (status != TX_SUCCESS)
+            {
+
+                /* Block memory error.  */
+                printf("ERROR #6\n");
+                test_control_return(1);
+            }
+        }
+        elapsed +=  time_get() - start;
+
+        /* The cache stays bounded.  */
+        if ((cached_get(&thread_0) > TEST_CACHE_SIZE) ||
+            ((pool_0.tx_block_pool_available + cached_get(&thread_0)) != TEST_BLOCKS))
+        {
+
+            /* Block memory error.  */
+            printf("ERROR #7\n");
+            test_control_return(1);
+        }
+    }
+
+#ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
+
+    /* The allocations and releases served by the cache are counted.  */
+    count =  0;
+    for (cycle = 0; cycle < TEST_CYCLES; cycle++)
+        count +=  (UINT) (1 + (cycle % TEST_WORKING_SET));
+    status =  tx_block_pool_performance_info_get(&pool_0, &allocates, &releases, TX_NULL, TX_NULL);
+    if ((status != TX_SUCCESS) || (allocates != (ULONG) (count + 1)) || (releases != (ULONG) (count + 1)))
+    {
+
+        /* Block memory error.  */
+        printf("ERROR #8\n");
+        test_control_return(1);
+    }
+#endif
+
+    /* The whole pool can be allocated.  */
+    count =  0;
+    while (tx_block_allocate(&pool_0, (VOID **) &pointer, TX_NO_WAIT) == TX_SUCCESS)
+    {
+
+        blocks[count++] =  pointer;
+        if (count > TEST_BLOCKS)
+            break;
+    }
+    if ((count != TEST_BLOCKS) || (cached_get(&thread_0) != 0) || (pool_0.tx_block_pool_available != 0))
+    {
+
+        /* Block memory error.  */
+        printf("ERROR #9\n");
+        test_control_return(1);
+    }
+
+    status =  TX_SUCCESS;
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+
+    /* Release a block to the cache, the pool stays empty.  */
+    status =  tx_block_release(blocks[--count]);
+#endif
+
+    /* Thread 1 suspends on the pool.  */
+    status +=  tx_thread_resume(&thread_1);
+    if ((status != TX_SUCCESS) || (thread_1.tx_thread_state != TX_BLOCK_MEMORY))
+    {
+
+        /* Block memory error.  */
+        printf("ERROR #10\n");
+        test_control_return(1);
+    }
+
+    /* A block released while a thread is suspended goes to this thread.  */
+    status =  tx_block_release(blocks[--count]);
+    if ((status != TX_SUCCESS) || (thread_1_counter != 1) || (thread_1.tx_thread_state != TX_BLOCK_MEMORY))
+    {
+
+        /* Block memory error.  */
+        printf("ERROR #11\n");
+        test_control_return(1);
+    }
+
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+
+    /* Moving the cache to another pool gives the cached block to the suspended thread.  */
+    if (cached_get(&thread_0) != 1)
+    {
+
+        /* Block memory error.  */
+        printf("ERROR #12\n");
+        test_control_return(1);
+    }
+    status =  tx_block_allocate(&pool_1, (VOID **) &pointer, TX_NO_WAIT);
+    status += tx_block_release(pointer);
+    if ((status != TX_SUCCESS) || (thread_1_counter != 2) || (thread_0.tx_thread_block_cache_pool != &pool_1))
+    {
+
+        /* Block memory error.  */
+        printf("ERROR #13\n");
+        test_control_return(1);
+    }
+#endif
+
+    /* Terminate thread 1 and release everything.  */
+    status =  tx_thread_terminate(&thread_1);
+    for (j = 0; j < thread_1_counter; j++)
+        status +=  tx_block_release(thread_1_blocks[j]);
+    while (count != 0)
+        status +=  tx_block_release(blocks[--count]);
+    if ((status != TX_SUCCESS) || (pool_0.tx_block_pool_available != TEST_BLOCKS))
+    {
+
+        /* Block memory error.  */
+        printf("ERROR #14\n");
+        test_control_return(1);
+    }
+
+    /* Thread 2 allocates and releases a block, then completes with its cache.  */
+    status =  tx_thread_resume(&thread_2);
+    tx_thread_sleep(2);
+    if ((status != TX_SUCCESS) || (thread_2.tx_thread_state != TX_COMPLETED) ||
+        ((pool_0.tx_block_pool_available + cached_get(&thread_2)) != TEST_BLOCKS))
+    {
+
+        /* Block memory error.  */
+        printf("ERROR #15\n");
+        test_control_return(1);
+    }
+
+    /* Deleting the thread flushes its cache.  */
+    status =  tx_thread_delete(&thread_2);
+    if ((status != TX_SUCCESS) || (pool_0.tx_block_pool_available != TEST_BLOCKS))
+    {
+
+        /* Block memory error.  */
+        printf("ERROR #16\n");
+        test_control_return(1);
+    }
+
+    /* Deleting the pool drops the caches bound to it.  */
+    status =  tx_block_allocate(&pool_0, (VOID **) &pointer, TX_NO_WAIT);
+    status += tx_block_release(pointer);
+    status += tx_block_pool_delete(&pool_0);
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+    if ((status != TX_SUCCESS) || (thread_0.tx_thread_block_cache_pool != TX_NULL) || (cached_get(&thread_0) != 0))
+#else
+    if (status != TX_SUCCESS)
+#endif
+    {
+
+        /* Block memory error.  */
+        printf("ERROR #17\n");
+        test_control_return(1);
+    }
+
+    /* Successful test.  */
+    printf("SUCCESS!\n");
+
+#ifdef TX_BLOCK_POOL_ENABLE_THREAD_CACHE
+    printf("    thread block cache, size %u, refill %u\n", (unsigned) TX_BLOCK_POOL_THREAD_CACHE_SIZE,
+           (unsigned) TX_BLOCK_POOL_THREAD_CACHE_REFILL);
+#else
+    printf("    no thread block cache\n");
+#endif
+    count =  0;
+    for (cycle = 0; cycle < TEST_CYCLES; cycle++)
+        count +=  (UINT) (1 + (cycle % TEST_WORKING_SET));
+    printf("    %lu allocates and releases, %lu ns per allocate and release\n", (unsigned long) count,
+           (unsigned long) (elapsed / count));
+
+    test_control_return(0);
+}
+
+
+static void    thread_1_entry(ULONG thread_input)
+{
+
+UINT    status;
+
+
+    while (thread_1_counter < 4)
+    {
+
+        /* Wait for a block.  */
+        status =  tx_block_allocate(&pool_0, (VOID **) &thread_1_blocks[thread_1_counter], TX_WAIT_FOREVER);
+        if (status != TX_SUCCESS)
+            break;
+        thread_1_counter++;
+    }
+}
+
+
+static void    thread_2_entry(ULONG thread_input)
+{
+
+UCHAR   *pointer;
+
+
+    /* Allocate and release a block.  */
+    if (tx_block_allocate(&pool_0, (VOID **) &pointer, TX_NO_WAIT) == TX_SUCCESS)
+        tx_block_release(pointer);
+}
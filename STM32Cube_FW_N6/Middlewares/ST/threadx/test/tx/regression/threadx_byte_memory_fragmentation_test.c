@@ -0,0 +1,399 @@
+/* This test is designed to test byte memory under a fragmenting workload of mixed
+   small and large blocks with random lifetimes. It checks the content of every block,
+   the pool chain and the available bytes, and reports the allocate and release latency
+   distributions so that the first fit and the segregated fit (TX_BYTE_POOL_ENABLE_TLSF)
+   allocators can be compared. With the segregated fit allocator and the byte pool
+   performance information, it also checks that each allocation examines at most one
+   free block.  */
+
+#include   <stdio.h>
+#include   <stdlib.h>
+#include   "tx_api.h"
+#include   "tx_byte_pool.h"
+
+
+#define TEST_POOL_SIZE          65536
+#define TEST_SLOTS              256
+#define TEST_OPERATIONS         40000
+
+
+static TX_THREAD       thread_0;
+
+static TX_BYTE_POOL    pool_0;
+static ALIGN_TYPE      pool_area[TEST_POOL_SIZE / sizeof(ALIGN_TYPE)];
+
+static UCHAR           *slot_pointer[TEST_SLOTS];
+static ULONG           slot_size[TEST_SLOTS];
+
+static ULONG           allocate_latency[TEST_OPERATIONS];
+static ULONG           release_latency[TEST_OPERATIONS];
+static ULONG           random_state =  0x12345678;
+
+
+/* Define thread prototypes.  */
+
+static void    thread_0_entry(ULONG thread_input);
+
+UINT  _tx_byte_pool_performance_info_get(TX_BYTE_POOL *pool_ptr, ULONG *allocates, ULONG *releases,
+                    ULONG *fragments_searched, ULONG *merges, ULONG *splits, ULONG *suspensions, ULONG *timeouts);
+
+
+/* Prototype for test control return.  */
+void  test_control_return(UINT status);
+
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+void test_application_define(void *first_unused_memory)
+#else
+void    threadx_byte_memory_fragmentation_application_define(void *first_unused_memory)
+#endif
+{
+
+UINT    status;
+CHAR    *pointer;
+
+
+    /* Put first available memory address into a character pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    /* Put system definition stuff in here, e.g. thread creates and other assorted
+       create information.  */
+
+    status =  tx_thread_create(&thread_0, "thread 0", thread_0_entry, 1,
+            pointer, TEST_STACK_SIZE_PRINTF,
+            17, 17, 100, TX_AUTO_START);
+    pointer = pointer + TEST_STACK_SIZE_PRINTF;
+
+    /* Check status.  */
+    if (status != TX_SUCCESS)
+    {
+
+        printf("Running Byte Memory Fragmentation Test.............................. ERROR #1\n");
+        test_control_return(1);
+    }
+
+    /* Create the byte pool outside of the test memory area so that its size does
+       not depend on the memory left by the other tests.  */
+    status =  tx_byte_pool_create(&pool_0, "pool 0", pool_area, TEST_POOL_SIZE);
+
+    /* Check status.  */
+    if (status != TX_SUCCESS)
+    {
+
+        printf("Running Byte Memory Fragmentation Test.............................. ERROR #2\n");
+        test_control_return(1);
+    }
+}
+
+
+static ULONG   random_get(void)
+{
+
+    random_state =  (random_state * 1103515245UL) + 12345UL;
+    return((random_state >> 8) & 0xFFFFFF);
+}
+
+
+static ULONG   time_get(void)
+{
+
+struct timespec ts;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return((ULONG) (((ULONG) ts.tv_sec * 1000000000UL) + (ULONG) ts.tv_nsec));
+}
+
+
+static int     latency_compare(const void *a, const void *b)
+{
+
+ULONG   x =  *((const ULONG *) a);
+ULONG   y =  *((const ULONG *) b);
+
+
+    return((x > y) - (x < y));
+}
+
+
+static void    latency_print(const CHAR *name, ULONG *latency, ULONG count)
+{
+
+    qsort(latency, count, sizeof(ULONG), latency_compare);
+    printf("    %s %lu ops: p50 %lu ns, p99 %lu ns, max %lu ns\n", name, (unsigned long) count,
+           (unsigned long) latency[count / 2], (unsigned long) latency[(count * 99) / 100],
+           (unsigned long) latency[count - 1]);
+}
+
+
+/* Walk the physical chain of the pool and return the sum of the free block sizes, or
+   0 if a block is corrupted.  */
+
+static ULONG   pool_check(void)
+{
+
+UCHAR       *current_ptr;
+UCHAR       *next_ptr;
+ALIGN_TYPE  owner;
+ULONG       total =  0;
+ULONG       free_bytes =  0;
+UINT        blocks =  0;
+
+
+    current_ptr =  pool_0.tx_byte_pool_list;
+    do
+    {
+
+        next_ptr =  *((UCHAR **) ((VOID *) current_ptr));
+        owner =     *((ALIGN_TYPE *) ((VOID *) (current_ptr + sizeof(UCHAR *))));
+        blocks++;
+        if (next_ptr != pool_0.tx_byte_pool_start)
+        {
+
+            if ((next_ptr <= current_ptr) || (blocks > pool_0.tx_byte_pool_fragments))
+                return(0);
+            total +=  (ULONG) (next_ptr - current_ptr);
+        }
+        else
+        {
+
+            /* The reserved block at the end of the pool.  */
+            total +=  (ULONG) (sizeof(UCHAR *) + sizeof(ALIGN_TYPE));
+        }
+
+        if (owner == TX_BYTE_BLOCK_FREE)
+        {
+
+            free_bytes +=  (ULONG) (next_ptr - current_ptr);
+        }
+#ifdef TX_BYTE_POOL_ENABLE_TLSF
+        else if ((owner & (~TX_BYTE_POOL_TLSF_PREVIOUS_FREE)) != (ALIGN_TYPE) ((VOID *) &pool_0))
+#else
+        else if (owner != (ALIGN_TYPE) ((VOID *) &pool_0))
+#endif
+        {
+
+            return(0);
+        }
+        current_ptr =  next_ptr;
+    } while (current_ptr != pool_0.tx_byte_pool_start);
+
+    /* The blocks must cover the whole pool.  */
+    if ((total != pool_0.tx_byte_pool_size) || (blocks != pool_0.tx_byte_pool_fragments))
+        return(0);
+
+    return(free_bytes);
+}
+
+
+/* Define the test threads.  */
+
+static void    thread_0_entry(ULONG thread_input)
+{
+
+UINT    status;
+ULONG   initial_available;
+ULONG   operation;
+ULONG   slot;
+ULONG   block_size;
+ULONG   i;
+ULONG   start;
+ULONG   allocates =  0;
+ULONG   releases =  0;
+ULONG   failures =  0;
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+ULONG   searched;
+ULONG   searched_before;
+ULONG   searched_max =  0;
+ULONG   searched_total =  0;
+ULONG   merges;
+ULONG   splits;
+#endif
+UCHAR   *pointer;
+
+
+    /* Inform user.  */
+    printf("Running Byte Memory Fragmentation Test.............................. ");
+
+    initial_available =  pool_0.tx_byte_pool_available;
+
+    for (operation = 0; operation < TEST_OPERATIONS; operation++)
+    {
+
+        slot =  random_get() % TEST_SLOTS;
+        if (slot_pointer[slot] == TX_NULL)
+        {
+
+            /* Mostly small blocks, with some large ones pinning fragments.  */
+            if ((random_get() % 8) != 0)
+                block_size =  8 + (random_get() % 120);
+            else
+                block_size =  256 + (random_get() % 2048);
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+            _tx_byte_pool_performance_info_get(&pool_0, TX_NULL, TX_NULL, &searched_before, TX_NULL, TX_NULL, TX_NULL, TX_NULL);
+#endif
+            start =   time_get();
+            status =  tx_byte_allocate(&pool_0, (VOID **) &pointer, block_size, TX_NO_WAIT);
+            allocate_latency[allocates] =  time_get() - start;
+
+            if (status == TX_SUCCESS)
+            {
+
+                allocates++;
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+                /* Count the fragments searched by this allocation.  */
+                _tx_byte_pool_performance_info_get(&pool_0, TX_NULL, TX_NULL, &searched, TX_NULL, TX_NULL, TX_NULL, TX_NULL);
+                searched =  searched - searched_before;
+                searched_total +=  searched;
+                if (searched > searched_max)
+                    searched_max =  searched;
+#endif
+
+                /* Fill the block with a pattern of its slot.  */
+                TX_MEMSET(pointer, (UCHAR) slot, block_size);
+                slot_pointer[slot] =  pointer;
+                slot_size[slot] =     block_size;
+            }
+            else if (status == TX_NO_MEMORY)
+            {
+
+                failures++;
+            }
+            else
+            {
+
+                /* Byte memory error.  */
+                printf("ERROR #3\n");
+                test_control_return(1);
+            }
+        }
+        else
+        {
+
+            /* Check the pattern of the block.  */
+            pointer =  slot_pointer[slot];
+            for (i = 0; i < slot_size[slot]; i++)
+            {
+
+                if (pointer[i] != (UCHAR) slot)
+                {
+
+                    /* Byte memory error.  */
+                    printf("ERROR #4\n");
+                    test_control_return(1);
+                }
+            }
+
+            start =   time_get();
+            status =  tx_byte_release(pointer);
+            release_latency[releases] =  time_get() - start;
+            releases++;
+
+            /* Check status.  */
+            if (status != TX_SUCCESS)
+            {
+
+                /* Byte memory error.  */
+                printf("ERROR #5\n");
+                test_control_return(1);
+            }
+            slot_pointer[slot] =  TX_NULL;
+        }
+
+        /* Check the pool chain from time to time.  */
+        if (((operation % 1024) == 0) && (pool_check() == 0))
+        {
+
+            /* Byte memory error.  */
+            printf("ERROR #6\n");
+            test_control_return(1);
+        }
+    }
+
+#if defined(TX_BYTE_POOL_ENABLE_TLSF) && defined(TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO)
+
+    /* Each allocation takes the head of a free list.  */
+    if (searched_max > 1)
+    {
+
+        /* Byte memory error.  */
+        printf("ERROR #7\n");
+        test_control_return(1);
+    }
+#endif
+
+    /* Release all the remaining blocks.  */
+    for (slot = 0; slot < TEST_SLOTS; slot++)
+    {
+
+        if (slot_pointer[slot] != TX_NULL)
+        {
+
+            status =  tx_byte_release(slot_pointer[slot]);
+            if (status != TX_SUCCESS)
+            {
+
+                /* Byte memory error.  */
+                printf("ERROR #8\n");
+                test_control_return(1);
+            }
+            slot_pointer[slot] =  TX_NULL;
+        }
+    }
+
+    /* All the memory must be back.  */
+    if ((pool_0.tx_byte_pool_available != initial_available) || (pool_check() != initial_available))
+    {
+
+        /* Byte memory error.  */
+        printf("ERROR #9\n");
+        test_control_return(1);
+    }
+
+#ifdef TX_BYTE_POOL_ENABLE_TLSF
+
+    /* Free blocks are merged on release, the pool must be back to a single free block.  */
+    if (pool_0.tx_byte_pool_fragments != 2)
+    {
+
+        /* Byte memory error.  */
+        printf("ERROR #10\n");
+        test_control_return(1);
+    }
+#endif
+
+    /* The whole pool must be allocatable again.  */
+    block_size =  initial_available - (ULONG) (sizeof(UCHAR *) + sizeof(ALIGN_TYPE));
+    status =  tx_byte_allocate(&pool_0, (VOID **) &pointer, block_size, TX_NO_WAIT);
+    status += tx_byte_release(pointer);
+    if (status != TX_SUCCESS)
+    {
+
+        /* Byte memory error.  */
+        printf("ERROR #11\n");
+        test_control_return(1);
+    }
+
+    /* Successful test.  */
+    printf("SUCCESS!\n");
+
+#ifdef TX_BYTE_POOL_ENABLE_TLSF
+    printf("    segregated fit allocator, %lu allocates, %lu failed\n", (unsigned long) allocates, (unsigned long) failures);
+#else
+    printf("    first fit allocator, %lu allocates, %lu failed\n", (unsigned long) allocates, (unsigned long) failures);
+#endif
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+    _tx_byte_pool_performance_info_get(&pool_0, TX_NULL, TX_NULL, TX_NULL, &merges, &splits, TX_NULL, TX_NULL);
+    printf("    fragments searched avg %lu.%02lu max %lu, %lu merges, %lu splits\n",
+           (unsigned long) (searched_total / allocates), (unsigned long) (((searched_total % allocates) * 100) / allocates),
+           (unsigned long) searched_max, (unsigned long) merges, (unsigned long) splits);
+#endif
+    latency_print("allocate", allocate_latency, allocates);
+    latency_print("release ", release_latency, releases);
+
+    test_control_return(0);
+}
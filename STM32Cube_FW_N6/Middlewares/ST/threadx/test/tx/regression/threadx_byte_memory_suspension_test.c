@@ -38,6 +38,7 @@ extern TEST_FLAG    threadx_byte_release_loop_test;
 void abort_and_resume_byte_allocating_thread(void)
 {
 
+#ifndef TX_BYTE_POOL_ENABLE_TLSF
 UCHAR   *search_ptr;
 
     /* Adjust the search pointer to avoid the search pointer change for this test.  */
@@ -48,6 +49,7 @@ UCHAR   *search_ptr;
         search_ptr =  *((UCHAR **) ((VOID *) search_ptr));
     }
     pool_0.tx_byte_pool_search =  search_ptr;
+#endif
    
     tx_thread_wait_abort(&thread_3);
     tx_thread_resume(&thread_3);
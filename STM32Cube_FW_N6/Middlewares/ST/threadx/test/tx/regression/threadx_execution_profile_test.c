@@ -0,0 +1,397 @@
+/* This test is designed to test the execution profile kit on the Linux port: thread
+   execution time, ready-to-running latency and run slice histograms, preemption counts by
+   a thread and by an ISR, ISR nesting time, profile record reuse and the profile report.  */
+
+#include   <stdio.h>
+#include   <string.h>
+#include   "tx_api.h"
+
+
+#define TEST_SEMAPHORE_PUTS     10
+#define TEST_ISR_WAKEUPS        3
+#define TEST_THREAD_CYCLES      20
+
+
+static unsigned long   thread_0_counter =  0;
+static TX_THREAD       thread_0;
+
+static unsigned long   thread_1_counter =  0;
+static TX_THREAD       thread_1;
+
+static volatile ULONG  thread_2_counter =  0;
+static TX_THREAD       thread_2;
+
+static unsigned long   thread_3_counter =  0;
+static TX_THREAD       thread_3;
+
+static TX_THREAD       thread_4;
+
+static TX_SEMAPHORE    semaphore_0;
+static TX_SEMAPHORE    semaphore_1;
+
+static CHAR            *thread_3_stack;
+
+static volatile UINT   isr_wakeup_enable =  TX_FALSE;
+static volatile ULONG  isr_counter =  0;
+
+#ifdef TX_EXECUTION_PROFILE_ENABLE_HISTOGRAMS
+static UINT            report_lines =  0;
+static UINT            report_errors =  0;
+static UINT            report_thread_1 =  0;
+static UINT            report_ended =  0;
+
+extern TX_EXECUTION_THREAD_PROFILE  _tx_execution_thread_profiles[TX_EXECUTION_PROFILE_THREADS + 1];
+#endif
+
+
+/* Define thread prototypes.  */
+
+static void    thread_0_entry(ULONG thread_input);
+static void    thread_1_entry(ULONG thread_input);
+static void    thread_2_entry(ULONG thread_input);
+static void    thread_3_entry(ULONG thread_input);
+
+
+/* Define the ISR dispatch and the ISR context functions.  */
+
+extern VOID    (*test_isr_dispatch)(void);
+VOID           _tx_thread_context_save(VOID);
+VOID           _tx_thread_context_restore(VOID);
+
+
+/* Prototype for test control return.  */
+
+void  test_control_return(UINT status);
+
+
+static void    isr_entry(void)
+{
+
+    /* Simulate an interrupt nested in the timer interrupt.  */
+    _tx_thread_context_save();
+
+    /* Count the nested interrupts.  */
+    isr_counter++;
+
+    /* Wake up thread 2 if requested, which preempts the interrupted thread.  */
+    if (isr_wakeup_enable == TX_TRUE)
+        tx_semaphore_put(&semaphore_1);
+
+    _tx_thread_context_restore();
+}
+
+
+#ifdef TX_EXECUTION_PROFILE_ENABLE_HISTOGRAMS
+
+static ULONG   histogram_sum(ULONG *histogram)
+{
+
+UINT    bin;
+ULONG   sum;
+
+
+    sum =  0;
+    for (bin = 0; bin < TX_EXECUTION_PROFILE_HISTOGRAM_BINS; bin++)
+        sum =  sum + histogram[bin];
+
+    return(sum);
+}
+
+
+static VOID    report_line(CHAR *line)
+{
+
+    /* Check the lines of the report.  */
+    if (strncmp(line, "TXEP,", 5) != 0)
+        report_errors++;
+    else if ((report_lines == 0) && (strcmp(line, "TXEP,BEGIN,32,4") != 0))
+        report_errors++;
+    else if (strncmp(line, "TXEP,THREAD,thread 1,", 21) == 0)
+        report_thread_1++;
+    else if (strcmp(line, "TXEP,END") == 0)
+        report_ended++;
+
+    report_lines++;
+}
+#endif
+
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+void test_application_define(void *first_unused_memory)
+#else
+void    threadx_execution_profile_application_define(void *first_unused_memory)
+#endif
+{
+
+UINT    status;
+CHAR    *pointer;
+
+
+    /* Put first available memory address into a character pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    /* Put system definition stuff in here, e.g. thread creates and other assorted
+       create information.  */
+
+    status =  tx_thread_create(&thread_0, "thread 0", thread_0_entry, 0,
+            pointer, TEST_STACK_SIZE_PRINTF,
+            16, 16, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer = pointer + TEST_STACK_SIZE_PRINTF;
+
+    status += tx_thread_create(&thread_1, "thread 1", thread_1_entry, 1,
+            pointer, TEST_STACK_SIZE_PRINTF,
+            15, 15, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer = pointer + TEST_STACK_SIZE_PRINTF;
+
+    status += tx_thread_create(&thread_2, "thread 2", thread_2_entry, 2,
+            pointer, TEST_STACK_SIZE_PRINTF,
+            14, 14, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer = pointer + TEST_STACK_SIZE_PRINTF;
+
+    /* Thread 4 is never started.  */
+    status += tx_thread_create(&thread_4, "thread 4", thread_3_entry, 4,
+            pointer, TEST_STACK_SIZE_PRINTF,
+            13, 13, TX_NO_TIME_SLICE, TX_DONT_START);
+    pointer = pointer + TEST_STACK_SIZE_PRINTF;
+
+    /* Keep a stack for thread 3, which is created several times.  */
+    thread_3_stack =  pointer;
+    pointer = pointer + TEST_STACK_SIZE_PRINTF;
+
+    status += tx_semaphore_create(&semaphore_0, "semaphore 0", 0);
+    status += tx_semaphore_create(&semaphore_1, "semaphore 1", 0);
+
+    /* Check status.  */
+    if (status != TX_SUCCESS)
+    {
+
+        printf("Running Execution Profile Test...................................... ERROR #1\n");
+        test_control_return(1);
+    }
+}
+
+
+/* Define the test threads.  */
+
+static void    thread_0_entry(ULONG thread_input)
+{
+
+UINT                        status;
+UINT                        index;
+#ifdef TX_EXECUTION_PROFILE_ENABLE
+EXECUTION_TIME              execution_time;
+#endif
+#ifdef TX_EXECUTION_PROFILE_ENABLE_HISTOGRAMS
+TX_EXECUTION_THREAD_PROFILE profile;
+TX_EXECUTION_ISR_PROFILE    isr_profile;
+UINT                        records;
+#endif
+
+
+    /* Inform user.  */
+    printf("Running Execution Profile Test...................................... ");
+
+    /* Increment the thread counter.  */
+    thread_0_counter++;
+
+#ifdef TX_EXECUTION_PROFILE_ENABLE_HISTOGRAMS
+
+    /* Start from an empty profile.  */
+    status =  _tx_execution_profile_reset();
+
+    /* Thread 4 was never scheduled, it has no profile.  */
+    status += _tx_execution_thread_profile_get(&thread_4, &profile);
+    if (status != TX_NOT_AVAILABLE)
+    {
+
+        /* Execution profile error.  */
+        printf("ERROR #2\n");
+        test_control_return(1);
+    }
+#endif
+
+    /* Wake up thread 1 several times, thread 0 is preempted each time.  */
+    for (index = 0; index < TEST_SEMAPHORE_PUTS; index++)
+    {
+
+        status =  tx_semaphore_put(&semaphore_0);
+        if ((status != TX_SUCCESS) || (thread_1_counter != (index + 1)))
+        {
+
+            /* Semaphore error.  */
+            printf("ERROR #3\n");
+            test_control_return(1);
+        }
+    }
+
+    /* Setup the nested ISR, then let it wake up thread 2 while thread 0 is running.  */
+    test_isr_dispatch =  isr_entry;
+    isr_wakeup_enable =  TX_TRUE;
+    while (thread_2_counter < TEST_ISR_WAKEUPS)
+    {
+    }
+    isr_wakeup_enable =  TX_FALSE;
+    test_isr_dispatch =  TX_NULL;
+
+    /* Create, run and delete thread 3 several times.  */
+    for (index = 0; index < TEST_THREAD_CYCLES; index++)
+    {
+
+        status =  tx_thread_create(&thread_3, "thread 3", thread_3_entry, 3,
+                thread_3_stack, TEST_STACK_SIZE_PRINTF,
+                15, 15, TX_NO_TIME_SLICE, TX_AUTO_START);
+        status += tx_thread_delete(&thread_3);
+        if ((status != TX_SUCCESS) || (thread_3_counter != (index + 1)))
+        {
+
+            /* Thread error.  */
+            printf("ERROR #4\n");
+            test_control_return(1);
+        }
+    }
+
+#ifdef TX_EXECUTION_PROFILE_ENABLE
+
+    /* Thread 0 has been running.  */
+    status =  _tx_execution_thread_time_get(&thread_0, &execution_time);
+    if ((status != TX_SUCCESS) || (execution_time == 0))
+    {
+
+        /* Execution profile error.  */
+        printf("ERROR #5\n");
+        test_control_return(1);
+    }
+#endif
+
+#ifdef TX_EXECUTION_PROFILE_ENABLE_HISTOGRAMS
+
+    /* Thread 1 waited to run and ran once for each semaphore put.  */
+    status =  _tx_execution_thread_profile_get(&thread_1, &profile);
+    if ((status != TX_SUCCESS) || (profile.tx_execution_profile_thread != &thread_1) ||
+        (histogram_sum(profile.tx_execution_profile_ready_histogram) != TEST_SEMAPHORE_PUTS) ||
+        (histogram_sum(profile.tx_execution_profile_slice_histogram) != TEST_SEMAPHORE_PUTS) ||
+        (profile.tx_execution_profile_ready_max == 0) || (profile.tx_execution_profile_slice_max == 0) ||
+        (profile.tx_execution_profile_preemptions != 0))
+    {
+
+        /* Execution profile error.  */
+        printf("ERROR #6\n");
+        test_control_return(1);
+    }
+
+    /* Thread 0 was preempted by thread 1, by thread 2 from the ISR and by thread 3.  */
+    status =  _tx_execution_thread_profile_get(&thread_0, &profile);
+    if ((status != TX_SUCCESS) ||
+        (profile.tx_execution_profile_preemptions < (TEST_SEMAPHORE_PUTS + TEST_ISR_WAKEUPS + TEST_THREAD_CYCLES)) ||
+        (histogram_sum(profile.tx_execution_profile_ready_histogram) < profile.tx_execution_profile_preemptions))
+    {
+
+        /* Execution profile error.  */
+        printf("ERROR #7\n");
+        test_control_return(1);
+    }
+
+    /* Thread 2 was woken up by the ISR.  */
+    status =  _tx_execution_thread_profile_get(&thread_2, &profile);
+    if ((status != TX_SUCCESS) || (histogram_sum(profile.tx_execution_profile_ready_histogram) != TEST_ISR_WAKEUPS))
+    {
+
+        /* Execution profile error.  */
+        printf("ERROR #8\n");
+        test_control_return(1);
+    }
+
+    /* The nested ISRs are accounted at the second nesting level.  */
+    status =  _tx_execution_isr_profile_get(&isr_profile);
+    if ((status != TX_SUCCESS) || (isr_profile.tx_execution_isr_profile_count == 0) ||
+        (isr_profile.tx_execution_isr_profile_nested_count < TEST_ISR_WAKEUPS) ||
+        (isr_profile.tx_execution_isr_profile_nesting_max != 2) ||
+        (isr_profile.tx_execution_isr_profile_level_time[0] == 0) ||
+        (isr_profile.tx_execution_isr_profile_level_time[1] == 0) ||
+        (histogram_sum(isr_profile.tx_execution_isr_profile_histogram) != isr_profile.tx_execution_isr_profile_count))
+    {
+
+        /* Execution profile error.  */
+        printf("ERROR #9\n");
+        test_control_return(1);
+    }
+
+    /* Thread 3 used the same record each time and no thread shares the last record.  */
+    records =  0;
+    for (index = 0; index < TX_EXECUTION_PROFILE_THREADS; index++)
+    {
+
+        if (_tx_execution_thread_profiles[index].tx_execution_profile_thread == &thread_3)
+            records++;
+    }
+    if ((records != 1) ||
+        (histogram_sum(_tx_execution_thread_profiles[TX_EXECUTION_PROFILE_THREADS].tx_execution_profile_slice_histogram) != 0))
+    {
+
+        /* Execution profile error.  */
+        printf("ERROR #10\n");
+        test_control_return(1);
+    }
+
+    /* Output the report.  */
+    status =  _tx_execution_profile_report(report_line);
+    if ((status != TX_SUCCESS) || (report_errors != 0) || (report_thread_1 != 1) || (report_ended != 1))
+    {
+
+        /* Execution profile error.  */
+        printf("ERROR #11\n");
+        test_control_return(1);
+    }
+
+    /* Clear the profile, the threads keep their records.  */
+    status =  _tx_execution_profile_reset();
+    status += _tx_execution_thread_profile_get(&thread_1, &profile);
+    if ((status != TX_SUCCESS) || (histogram_sum(profile.tx_execution_profile_ready_histogram) != 0))
+    {
+
+        /* Execution profile error.  */
+        printf("ERROR #12\n");
+        test_control_return(1);
+    }
+#endif
+
+    /* Successful test.  */
+    printf("SUCCESS!\n");
+    test_control_return(0);
+}
+
+
+static void    thread_1_entry(ULONG thread_input)
+{
+
+    /* Run once for each semaphore put.  */
+    while (tx_semaphore_get(&semaphore_0, TX_WAIT_FOREVER) == TX_SUCCESS)
+    {
+
+        /* Increment the thread counter.  */
+        thread_1_counter++;
+    }
+}
+
+
+static void    thread_2_entry(ULONG thread_input)
+{
+
+    /* Run once for each semaphore put by the ISR.  */
+    while (tx_semaphore_get(&semaphore_1, TX_WAIT_FOREVER) == TX_SUCCESS)
+    {
+
+        /* Increment the thread counter.  */
+        thread_2_counter++;
+    }
+}
+
+
+static void    thread_3_entry(ULONG thread_input)
+{
+
+    /* Increment the thread counter and complete.  */
+    thread_3_counter++;
+}
@@ -0,0 +1,386 @@
+/* This test is designed to test the job pool utility: a parallel for split in child jobs,
+   stealing between the workers, a job graph with dependencies, a worker waiting for its
+   child jobs, full deques and the deletion of a job pool.  */
+
+#include   <stdio.h>
+#include   "tx_api.h"
+#include   "tx_job_pool.h"
+
+
+#define TEST_WORKERS            3
+#define TEST_VALUES             1024
+#define TEST_GRAIN              32
+#define TEST_SPLIT_JOBS         ((2 * (TEST_VALUES / TEST_GRAIN)) - 1)
+
+
+static unsigned long   thread_0_counter =  0;
+static TX_THREAD       thread_0;
+
+static TX_JOB_POOL     pool_0;
+static TX_JOB_WORKER   pool_0_workers[TEST_WORKERS];
+
+static TX_JOB_POOL     pool_1;
+static TX_JOB_WORKER   pool_1_workers[1];
+
+static CHAR            *pool_0_stack;
+static CHAR            *pool_1_stack;
+
+static ULONG           values[TEST_VALUES];
+static ULONG           sums[TEST_VALUES / TEST_GRAIN];
+
+static TX_JOB          split_jobs[TEST_SPLIT_JOBS];
+static UINT            split_job_count;
+
+static TX_JOB          graph_jobs[4];
+static UINT            graph_order[5];
+static UINT            graph_count;
+
+static TX_JOB          wait_job;
+static TX_JOB          wait_children[8];
+static UINT            wait_children_done;
+static UINT            wait_status;
+
+static TX_JOB          fill_jobs[TX_JOB_POOL_DEQUE_SIZE + 1];
+static ULONG           fill_count;
+
+
+/* Define thread prototypes.  */
+
+static void    thread_0_entry(ULONG thread_input);
+
+
+/* Prototype for test control return.  */
+
+void  test_control_return(UINT status);
+
+
+/* Sum a range of values, split in two child jobs until the range is small enough.  */
+
+static VOID    split_job_entry(TX_JOB *job_ptr, ULONG job_input)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+ULONG   first;
+ULONG   count;
+ULONG   index;
+TX_JOB  *child_ptr;
+UINT    half;
+
+
+    /* The input is the first value and the number of values.  */
+    first =  job_input >> 16;
+    count =  job_input & 0xFFFF;
+
+    /* Determine if the range is small enough.  */
+    if (count <= TEST_GRAIN)
+    {
+
+        /* Sum the range.  */
+        sums[first / TEST_GRAIN] =  0;
+        for (index = first; index < (first + count); index++)
+            sums[first / TEST_GRAIN] =  sums[first / TEST_GRAIN] + values[index];
+
+        /* Let the other workers run.  */
+        tx_thread_relinquish();
+        return;
+    }
+
+    /* Split the range in two child jobs.  */
+    for (half = 0; half < 2; half++)
+    {
+
+        TX_DISABLE
+        child_ptr =  &split_jobs[split_job_count++];
+        TX_RESTORE
+
+        tx_job_create(child_ptr, split_job_entry, ((first + (half * (count / 2))) << 16) | (count / 2));
+        tx_job_child_add(job_ptr, child_ptr);
+        tx_job_submit(&pool_0, child_ptr);
+    }
+}
+
+
+/* Record the order of the jobs of the graph.  */
+
+static VOID    graph_job_entry(TX_JOB *job_ptr, ULONG job_input)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    TX_DISABLE
+    graph_order[graph_count++] =  (UINT) job_input;
+    TX_RESTORE
+
+    /* Let the other workers run.  */
+    tx_thread_relinquish();
+}
+
+
+/* Count the child jobs of the wait job.  */
+
+static VOID    wait_child_entry(TX_JOB *job_ptr, ULONG job_input)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    tx_thread_relinquish();
+
+    TX_DISABLE
+    wait_children_done++;
+    TX_RESTORE
+}
+
+
+/* Submit child jobs and wait for them in the job.  */
+
+static VOID    wait_job_entry(TX_JOB *job_ptr, ULONG job_input)
+{
+
+UINT    index;
+
+
+    /* The first child job is the parent of the other ones.  */
+    tx_job_create(&wait_children[0], wait_child_entry, 0);
+    for (index = 1; index < 8; index++)
+    {
+
+        tx_job_create(&wait_children[index], wait_child_entry, index);
+        tx_job_child_add(&wait_children[0], &wait_children[index]);
+        tx_job_submit(&pool_0, &wait_children[index]);
+    }
+    tx_job_submit(&pool_0, &wait_children[0]);
+
+    /* Wait for the first child, which is complete with the other ones.  */
+    wait_status =  tx_job_wait(&pool_0, &wait_children[0], TX_WAIT_FOREVER);
+    if (wait_children_done != 8)
+        wait_status =  TX_NOT_DONE;
+}
+
+
+/* Count the jobs of the full deque test.  */
+
+static VOID    fill_job_entry(TX_JOB *job_ptr, ULONG job_input)
+{
+
+    fill_count++;
+}
+
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+void test_application_define(void *first_unused_memory)
+#else
+void    threadx_job_pool_application_define(void *first_unused_memory)
+#endif
+{
+
+UINT    status;
+CHAR    *pointer;
+
+
+    /* Put first available memory address into a character pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    /* Put system definition stuff in here, e.g. thread creates and other assorted
+       create information.  */
+
+    status =  tx_thread_create(&thread_0, "thread 0", thread_0_entry, 1,
+            pointer, TEST_STACK_SIZE_PRINTF,
+            16, 16, 100, TX_AUTO_START);
+    pointer = pointer + TEST_STACK_SIZE_PRINTF;
+
+    /* Keep the stacks of the workers.  */
+    pool_0_stack =  pointer;
+    pointer = pointer + (TEST_WORKERS * TEST_STACK_SIZE_PRINTF);
+    pool_1_stack =  pointer;
+    pointer = pointer + TEST_STACK_SIZE_PRINTF;
+
+    /* Check status.  */
+    if (status != TX_SUCCESS)
+    {
+
+        printf("Running Job Pool Test............................................... ERROR #1\n");
+        test_control_return(1);
+    }
+}
+
+
+/* Define the test threads.  */
+
+static void    thread_0_entry(ULONG thread_input)
+{
+
+UINT    status;
+UINT    index;
+ULONG   total;
+ULONG   executed;
+ULONG   stolen;
+ULONG   idle_count;
+
+
+    /* Inform user.  */
+    printf("Running Job Pool Test............................................... ");
+
+    /* Increment the thread counter.  */
+    thread_0_counter++;
+
+    /* Attempt to create a job pool without workers.  */
+    status =  tx_job_pool_create(&pool_0, "pool 0", pool_0_workers, 0, pool_0_stack, TEST_STACK_SIZE_PRINTF, 10);
+    if (status != TX_SIZE_ERROR)
+    {
+
+        /* Job pool error.  */
+        printf("ERROR #2\n");
+        test_control_return(1);
+    }
+
+    /* Create the job pool, its workers have a higher priority than thread 0.  */
+    status =  tx_job_pool_create(&pool_0, "pool 0", pool_0_workers, TEST_WORKERS, pool_0_stack, TEST_STACK_SIZE_PRINTF, 10);
+    if (status != TX_SUCCESS)
+    {
+
+        /* Job pool error.  */
+        printf("ERROR #3\n");
+        test_control_return(1);
+    }
+
+    /* Run a parallel for over the values.  */
+    total =  0;
+    for (index = 0; index < TEST_VALUES; index++)
+    {
+
+        values[index] =  index * 3;
+        total =  total + values[index];
+    }
+    split_job_count =  1;
+    status =  tx_job_create(&split_jobs[0], split_job_entry, TEST_VALUES);
+    status += tx_job_submit(&pool_0, &split_jobs[0]);
+    status += tx_job_wait(&pool_0, &split_jobs[0], TX_WAIT_FOREVER);
+    for (index = 0; index < (TEST_VALUES / TEST_GRAIN); index++)
+        total =  total - sums[index];
+    status += tx_job_pool_info_get(&pool_0, &executed, &stolen, &idle_count);
+    if ((status != TX_SUCCESS) || (total != 0) || (split_job_count != TEST_SPLIT_JOBS) ||
+        (executed != TEST_SPLIT_JOBS) || (stolen == 0) || (idle_count != TEST_WORKERS))
+    {
+
+        /* Job pool error.  */
+        printf("ERROR #4\n");
+        test_control_return(1);
+    }
+
+    /* A job that is complete cannot be submitted again.  */
+    status =  tx_job_submit(&pool_0, &split_jobs[0]);
+    if (status != TX_NOT_AVAILABLE)
+    {
+
+        /* Job pool error.  */
+        printf("ERROR #5\n");
+        test_control_return(1);
+    }
+
+    /* Build a graph: job 1 and job 2 depend on job 0, job 3 depends on job 1 and job 2.
+       Submit the jobs in the reverse order.  */
+    for (index = 0; index < 4; index++)
+        status =  tx_job_create(&graph_jobs[index], graph_job_entry, index);
+    status =  tx_job_depend(&graph_jobs[1], &graph_jobs[0]);
+    status += tx_job_depend(&graph_jobs[2], &graph_jobs[0]);
+    status += tx_job_depend(&graph_jobs[3], &graph_jobs[1]);
+    status += tx_job_depend(&graph_jobs[3], &graph_jobs[2]);
+    for (index = 4; index > 0; index--)
+    {
+
+        status += tx_job_submit(&pool_0, &graph_jobs[index - 1]);
+
+        /* No job can run before job 0 is submitted.  */
+        if ((index > 1) && (graph_count != 0))
+            status++;
+    }
+    status += tx_job_wait(&pool_0, &graph_jobs[3], TX_WAIT_FOREVER);
+    if ((status != TX_SUCCESS) || (graph_count != 4) || (graph_order[0] != 0) || (graph_order[3] != 3) ||
+        (graph_jobs[1].tx_job_unfinished != 0) || (graph_jobs[2].tx_job_unfinished != 0))
+    {
+
+        /* Job pool error.  */
+        printf("ERROR #6\n");
+        test_control_return(1);
+    }
+
+    /* A job that depends on a complete job is ready when it is submitted.  */
+    status =  tx_job_create(&graph_jobs[1], graph_job_entry, 1);
+    status += tx_job_depend(&graph_jobs[1], &graph_jobs[0]);
+    status += tx_job_submit(&pool_0, &graph_jobs[1]);
+    status += tx_job_wait(&pool_0, &graph_jobs[1], TX_WAIT_FOREVER);
+    if ((status != TX_SUCCESS) || (graph_count != 5))
+    {
+
+        /* Job pool error.  */
+        printf("ERROR #7\n");
+        test_control_return(1);
+    }
+
+    /* Run a job that waits for its child jobs in a worker.  */
+    status =  tx_job_create(&wait_job, wait_job_entry, 0);
+    status += tx_job_submit(&pool_0, &wait_job);
+    status += tx_job_wait(&pool_0, &wait_job, TX_WAIT_FOREVER);
+    if ((status != TX_SUCCESS) || (wait_status != TX_SUCCESS) || (wait_children_done != 8))
+    {
+
+        /* Job pool error.  */
+        printf("ERROR #8\n");
+        test_control_return(1);
+    }
+
+    /* Create a job pool with a worker of a lower priority than thread 0, and fill its deque.  */
+    status =  tx_job_pool_create(&pool_1, "pool 1", pool_1_workers, 1, pool_1_stack, TEST_STACK_SIZE_PRINTF, 20);
+    for (index = 0; index < TX_JOB_POOL_DEQUE_SIZE; index++)
+    {
+
+        status += tx_job_create(&fill_jobs[index], fill_job_entry, index);
+        status += tx_job_submit(&pool_1, &fill_jobs[index]);
+    }
+    status += tx_job_create(&fill_jobs[index], fill_job_entry, index);
+    if ((status != TX_SUCCESS) || (tx_job_submit(&pool_1, &fill_jobs[index]) != TX_QUEUE_FULL) || (fill_count != 0))
+    {
+
+        /* Job pool error.  */
+        printf("ERROR #9\n");
+        test_control_return(1);
+    }
+
+    /* The job can be submitted again once the worker ran the other jobs, the oldest
+       job last.  */
+    status =  tx_job_wait(&pool_1, &fill_jobs[0], TX_WAIT_FOREVER);
+    status += tx_job_submit(&pool_1, &fill_jobs[index]);
+    status += tx_job_wait(&pool_1, &fill_jobs[index], TX_WAIT_FOREVER);
+    if ((status != TX_SUCCESS) || (fill_count != (TX_JOB_POOL_DEQUE_SIZE + 1)))
+    {
+
+        /* Job pool error.  */
+        printf("ERROR #10\n");
+        test_control_return(1);
+    }
+
+    /* Delete the job pools.  */
+    status =  tx_job_pool_delete(&pool_0);
+    status += tx_job_pool_delete(&pool_1);
+    status += tx_job_create(&fill_jobs[0], fill_job_entry, 0);
+    if ((status != TX_SUCCESS) || (tx_job_submit(&pool_0, &fill_jobs[0]) != TX_PTR_ERROR) ||
+        (pool_0_workers[0].tx_job_worker_thread.tx_thread_id != TX_CLEAR_ID))
+    {
+
+        /* Job pool error.  */
+        printf("ERROR #11\n");
+        test_control_return(1);
+    }
+    else
+    {
+
+        /* Successful test.  */
+        printf("SUCCESS!\n");
+        test_control_return(0);
+    }
+}
@@ -0,0 +1,387 @@
+/* This test is designed to test the pointer send and receive services on a queue of
+   TX_POINTER_ULONG messages that holds 8 pointers: batches limited by the queue room and
+   content, wrap around, the send notify callback, hand-off to a suspended receiver and
+   a suspended sender.  */
+
+#include   <stdio.h>
+#include   "tx_api.h"
+
+
+#define TEST_QUEUE_POINTERS     8
+
+
+static unsigned long   thread_0_counter =  0;
+static TX_THREAD       thread_0;
+
+static unsigned long   thread_1_counter =  0;
+static TX_THREAD       thread_1;
+
+static unsigned long   thread_2_counter =  0;
+static TX_THREAD       thread_2;
+
+static TX_QUEUE        queue_0;
+static TX_QUEUE        queue_1;
+
+static VOID            *queue_0_area[TEST_QUEUE_POINTERS];
+static ULONG           queue_1_area[TEST_QUEUE_POINTERS * TX_4_ULONG];
+
+static UCHAR           frames[16][4];
+
+static unsigned long   notify_counter =  0;
+
+static VOID            *thread_1_pointers[16];
+static UINT            thread_1_received =  0;
+
+static UINT            thread_2_status;
+static UINT            thread_2_sent;
+
+
+/* Define thread prototypes.  */
+
+static void    thread_0_entry(ULONG thread_input);
+static void    thread_1_entry(ULONG thread_input);
+static void    thread_2_entry(ULONG thread_input);
+
+
+/* Prototype for test control return.  */
+
+void  test_control_return(UINT status);
+
+
+static void    queue_notify(TX_QUEUE *queue_ptr)
+{
+
+    /* Count the notifications of the pointer queue.  */
+    if (queue_ptr == &queue_0)
+        notify_counter++;
+}
+
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+void test_application_define(void *first_unused_memory)
+#else
+void    threadx_queue_pointer_application_define(void *first_unused_memory)
+#endif
+{
+
+UINT    status;
+CHAR    *pointer;
+
+
+    /* Put first available memory address into a character pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    /* Put system definition stuff in here, e.g. thread creates and other assorted
+       create information.  */
+
+    status =  tx_thread_create(&thread_0, "thread 0", thread_0_entry, 1,
+            pointer, TEST_STACK_SIZE_PRINTF,
+            16, 16, 100, TX_AUTO_START);
+    pointer = pointer + TEST_STACK_SIZE_PRINTF;
+
+    status += tx_thread_create(&thread_1, "thread 1", thread_1_entry, 1,
+            pointer, TEST_STACK_SIZE_PRINTF,
+            15, 15, 100, TX_DONT_START);
+    pointer = pointer + TEST_STACK_SIZE_PRINTF;
+
+    status += tx_thread_create(&thread_2, "thread 2", thread_2_entry, 1,
+            pointer, TEST_STACK_SIZE_PRINTF,
+            15, 15, 100, TX_DONT_START);
+    pointer = pointer + TEST_STACK_SIZE_PRINTF;
+
+    /* Create the pointer queue and a queue of 16-byte messages outside of the
+       test memory area.  */
+    status += tx_queue_create(&queue_0, "queue 0", TX_POINTER_ULONG, queue_0_area, sizeof(queue_0_area));
+    status += tx_queue_create(&queue_1, "queue 1", TX_4_ULONG, queue_1_area, sizeof(queue_1_area));
+
+    /* Check status.  */
+    if ((status != TX_SUCCESS) || (queue_0.tx_queue_capacity != TEST_QUEUE_POINTERS))
+    {
+
+        printf("Running Queue Pointer Test.......................................... ERROR #1\n");
+        test_control_return(1);
+    }
+}
+
+
+/* Check that the pointers received are consecutive frames.  */
+
+static UINT    frames_check(VOID **pointers, UINT count, UINT first)
+{
+
+UINT    index;
+
+
+    for (index = 0; index < count; index++)
+    {
+
+        if (pointers[index] != (VOID *) frames[first + index])
+            return(TX_FALSE);
+    }
+
+    return(TX_TRUE);
+}
+
+
+/* Define the test threads.  */
+
+static void    thread_0_entry(ULONG thread_input)
+{
+
+UINT    status;
+UINT    actual;
+UINT    index;
+VOID    *pointers[16];
+VOID    *received[16];
+
+
+    /* Inform user.  */
+    printf("Running Queue Pointer Test.......................................... ");
+
+    /* Increment the thread counter.  */
+    thread_0_counter++;
+
+    /* Build the pointers to send.  */
+    for (index = 0; index < 16; index++)
+        pointers[index] =  (VOID *) frames[index];
+
+#ifndef TX_DISABLE_ERROR_CHECKING
+
+    /* Attempt to send to a NULL queue.  */
+    status =  tx_queue_pointer_send(TX_NULL, pointers, 1, &actual, TX_NO_WAIT);
+    if (status != TX_QUEUE_ERROR)
+    {
+
+        /* Queue error.  */
+        printf("ERROR #2\n");
+        test_control_return(1);
+    }
+
+    /* Attempt to send a NULL array.  */
+    status =  tx_queue_pointer_send(&queue_0, TX_NULL, 1, &actual, TX_NO_WAIT);
+    if (status != TX_PTR_ERROR)
+    {
+
+        /* Queue error.  */
+        printf("ERROR #3\n");
+        test_control_return(1);
+    }
+
+    /* Attempt to receive without an actual count destination.  */
+    status =  tx_queue_pointer_receive(&queue_0, received, 1, TX_NULL, TX_NO_WAIT);
+    if (status != TX_PTR_ERROR)
+    {
+
+        /* Queue error.  */
+        printf("ERROR #4\n");
+        test_control_return(1);
+    }
+
+    /* Attempt to receive no pointer.  */
+    status =  tx_queue_pointer_receive(&queue_0, received, 0, &actual, TX_NO_WAIT);
+    if (status != TX_SIZE_ERROR)
+    {
+
+        /* Queue error.  */
+        printf("ERROR #5\n");
+        test_control_return(1);
+    }
+
+    /* Attempt to send pointers to a queue of 16-byte messages.  */
+    status =  tx_queue_pointer_send(&queue_1, pointers, 1, &actual, TX_NO_WAIT);
+    if (status != TX_SIZE_ERROR)
+    {
+
+        /* Queue error.  */
+        printf("ERROR #6\n");
+        test_control_return(1);
+    }
+#endif
+
+    /* Register the send notify callback.  */
+    status =  tx_queue_send_notify(&queue_0, queue_notify);
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+    /* Check status.  */
+    if (status != TX_SUCCESS)
+    {
+
+        /* Queue error.  */
+        printf("ERROR #7\n");
+        test_control_return(1);
+    }
+#endif
+
+    /* Send 5 pointers, they all fit.  */
+    status =  tx_queue_pointer_send(&queue_0, pointers, 5, &actual, TX_NO_WAIT);
+    if ((status != TX_SUCCESS) || (actual != 5) || (queue_0.tx_queue_enqueued != 5))
+    {
+
+        /* Queue error.  */
+        printf("ERROR #8\n");
+        test_control_return(1);
+    }
+
+    /* Send 5 more pointers, only 3 fit.  */
+    status =  tx_queue_pointer_send(&queue_0, &pointers[5], 5, &actual, TX_WAIT_FOREVER);
+    if ((status != TX_SUCCESS) || (actual != 3) || (queue_0.tx_queue_available_storage != 0))
+    {
+
+        /* Queue error.  */
+        printf("ERROR #9\n");
+        test_control_return(1);
+    }
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+    /* The callback is called once for each batch.  */
+    if (notify_counter != 2)
+    {
+
+        /* Queue error.  */
+        printf("ERROR #10\n");
+        test_control_return(1);
+    }
+#endif
+
+    /* Send to the full queue.  */
+    actual =  99;
+    status =  tx_queue_pointer_send(&queue_0, pointers, 1, &actual, TX_NO_WAIT);
+    if ((status != TX_QUEUE_FULL) || (actual != 0))
+    {
+
+        /* Queue error.  */
+        printf("ERROR #11\n");
+        test_control_return(1);
+    }
+
+    /* Receive everything.  */
+    status =  tx_queue_pointer_receive(&queue_0, received, 16, &actual, TX_WAIT_FOREVER);
+    if ((status != TX_SUCCESS) || (actual != 8) || (frames_check(received, 8, 0) != TX_TRUE))
+    {
+
+        /* Queue error.  */
+        printf("ERROR #12\n");
+        test_control_return(1);
+    }
+
+    /* Receive from the empty queue.  */
+    actual =  99;
+    status =  tx_queue_pointer_receive(&queue_0, received, 4, &actual, TX_NO_WAIT);
+    if ((status != TX_QUEUE_EMPTY) || (actual != 0) || (queue_0.tx_queue_available_storage != 8))
+    {
+
+        /* Queue error.  */
+        printf("ERROR #13\n");
+        test_control_return(1);
+    }
+
+    /* Move the queue read and write pointers to the middle of the queue, then send
+       and receive batches that wrap around.  */
+    status =  tx_queue_pointer_send(&queue_0, pointers, 5, &actual, TX_NO_WAIT);
+    status += tx_queue_pointer_receive(&queue_0, received, 5, &actual, TX_NO_WAIT);
+    status += tx_queue_pointer_send(&queue_0, &pointers[2], 7, &actual, TX_NO_WAIT);
+    if ((status != TX_SUCCESS) || (actual != 7))
+    {
+
+        /* Queue error.  */
+        printf("ERROR #14\n");
+        test_control_return(1);
+    }
+
+    /* The pointers come out in order, whether received singly or in a batch.  */
+    status =  tx_queue_receive(&queue_0, &received[0], TX_NO_WAIT);
+    status += tx_queue_pointer_receive(&queue_0, &received[1], 6, &actual, TX_NO_WAIT);
+    if ((status != TX_SUCCESS) || (actual != 6) || (frames_check(received, 7, 2) != TX_TRUE))
+    {
+
+        /* Queue error.  */
+        printf("ERROR #15\n");
+        test_control_return(1);
+    }
+
+    /* Start thread 1, which suspends on the empty queue.  */
+    tx_thread_resume(&thread_1);
+
+    /* Send 3 pointers, which go to the suspended thread 1 one by one.  */
+    status =  tx_queue_pointer_send(&queue_0, pointers, 3, &actual, TX_NO_WAIT);
+    if ((status != TX_SUCCESS) || (actual != 3) || (thread_1_received != 3) ||
+        (frames_check(thread_1_pointers, 3, 0) != TX_TRUE) || (queue_0.tx_queue_enqueued != 0))
+    {
+
+        /* Queue error.  */
+        printf("ERROR #16\n");
+        test_control_return(1);
+    }
+
+    /* Fill the queue, then start thread 2, which suspends sending 2 more pointers.  */
+    status =  tx_queue_pointer_send(&queue_0, pointers, 8, &actual, TX_NO_WAIT);
+    tx_thread_resume(&thread_2);
+    if ((status != TX_SUCCESS) || (actual != 8) || (queue_0.tx_queue_suspended_count != 1))
+    {
+
+        /* Queue error.  */
+        printf("ERROR #17\n");
+        test_control_return(1);
+    }
+
+    /* Receive everything, which gets the first pointer of thread 2 in the queue.  */
+    status =  tx_queue_pointer_receive(&queue_0, received, 16, &actual, TX_NO_WAIT);
+    if ((status != TX_SUCCESS) || (actual != 9) || (frames_check(received, 9, 0) != TX_TRUE) ||
+        (thread_2_status != TX_SUCCESS) || (thread_2_sent != 1) || (thread_2_counter != 1))
+    {
+
+        /* Queue error.  */
+        printf("ERROR #18\n");
+        test_control_return(1);
+    }
+    else
+    {
+
+        /* Successful test.  */
+        printf("SUCCESS!\n");
+        test_control_return(0);
+    }
+}
+
+
+static void    thread_1_entry(ULONG thread_input)
+{
+
+UINT    status;
+UINT    actual;
+
+
+    /* Receive 3 pointers, waiting for them.  */
+    while (thread_1_received < 3)
+    {
+
+        /* Receive as many pointers as possible.  */
+        status =  tx_queue_pointer_receive(&queue_0, &thread_1_pointers[thread_1_received], 4, &actual, TX_WAIT_FOREVER);
+        if (status != TX_SUCCESS)
+            break;
+
+        /* Increment the thread counter.  */
+        thread_1_counter++;
+        thread_1_received =  thread_1_received + actual;
+    }
+}
+
+
+static void    thread_2_entry(ULONG thread_input)
+{
+
+VOID    *pointers[2];
+
+
+    /* Send frames 8 and 9, waiting for room in the queue.  */
+    pointers[0] =  (VOID *) frames[8];
+    pointers[1] =  (VOID *) frames[9];
+    thread_2_status =  tx_queue_pointer_send(&queue_0, pointers, 2, &thread_2_sent, TX_WAIT_FOREVER);
+
+    /* Increment the thread counter.  */
+    thread_2_counter++;
+}
@@ -0,0 +1,428 @@
+/* This test is designed to test timers that do not fit in the timer list: the expiration
+   time of many one-shot and periodic timers, the remaining ticks reported while they are
+   active and after a deactivation, and the next expiration and time increment services of
+   the low power utility. It then reports the cost of 10000 long timers, on the
+   activations, on the deactivations and on the timer thread, so that the timer list and
+   the hierarchical timing wheel (TX_TIMER_ENABLE_HIERARCHICAL_WHEEL) can be compared.  */
+
+#include   <stdio.h>
+#include   <time.h>
+#include   <pthread.h>
+#include   "tx_api.h"
+#include   "tx_timer.h"
+#include   "tx_low_power.h"
+
+
+#define TEST_ACCURACY_TIMERS    1000
+#define TEST_ACCURACY_MAX       300
+#define TEST_PERIODIC_TIMERS    10
+#define TEST_BENCH_TIMERS       10000
+#define TEST_BENCH_TICKS        100
+
+
+static TX_THREAD       thread_0;
+
+static TX_TIMER        accuracy_timer[TEST_ACCURACY_TIMERS];
+static ULONG           accuracy_expected[TEST_ACCURACY_TIMERS];
+static ULONG           accuracy_fired[TEST_ACCURACY_TIMERS];
+
+static TX_TIMER        periodic_timer[TEST_PERIODIC_TIMERS];
+static ULONG           periodic_first[TEST_PERIODIC_TIMERS];
+static ULONG           periodic_last[TEST_PERIODIC_TIMERS];
+static ULONG           periodic_count[TEST_PERIODIC_TIMERS];
+
+static TX_TIMER        long_timer[3];
+static ULONG           long_fired;
+
+static TX_TIMER        bench_timer[TEST_BENCH_TIMERS];
+static ULONG           random_state =  0x12345678;
+
+
+/* Define thread prototypes.  */
+
+static void    thread_0_entry(ULONG thread_input);
+static void    accuracy_expiration(ULONG timer_input);
+static void    periodic_expiration(ULONG timer_input);
+static void    long_expiration(ULONG timer_input);
+
+
+/* Prototype for test control return.  */
+void  test_control_return(UINT status);
+
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+void test_application_define(void *first_unused_memory)
+#else
+void    threadx_timer_wheel_application_define(void *first_unused_memory)
+#endif
+{
+
+UINT    status;
+CHAR    *pointer;
+
+
+    /* Put first available memory address into a character pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    /* Put system definition stuff in here, e.g. thread creates and other assorted
+       create information.  */
+
+    status =  tx_thread_create(&thread_0, "thread 0", thread_0_entry, 1,
+            pointer, TEST_STACK_SIZE_PRINTF,
+            16, 16, 100, TX_AUTO_START);
+    pointer = pointer + TEST_STACK_SIZE_PRINTF;
+
+    /* Check status.  */
+    if (status != TX_SUCCESS)
+    {
+
+        printf("Running Timer Hierarchical Wheel Test............................... ERROR #1\n");
+        test_control_return(1);
+    }
+}
+
+
+static void    accuracy_expiration(ULONG timer_input)
+{
+
+    accuracy_fired[timer_input] =  tx_time_get();
+}
+
+
+static void    periodic_expiration(ULONG timer_input)
+{
+
+    if (periodic_count[timer_input] == 0)
+        periodic_first[timer_input] =  tx_time_get();
+    periodic_last[timer_input] =  tx_time_get();
+    periodic_count[timer_input]++;
+}
+
+
+static void    long_expiration(ULONG timer_input)
+{
+
+    TX_PARAMETER_NOT_USED(timer_input);
+    long_fired =  tx_time_get();
+}
+
+
+static ULONG   random_get(void)
+{
+
+    random_state =  (random_state * 1103515245UL) + 12345UL;
+    return((random_state >> 8) & 0xFFFFFF);
+}
+
+
+static ULONG   time_get(clockid_t clock)
+{
+
+struct timespec ts;
+
+
+    clock_gettime(clock, &ts);
+    return((ULONG) (((ULONG) ts.tv_sec * 1000000000UL) + (ULONG) ts.tv_nsec));
+}
+
+
+/* Check that a timer fired at its expiration time. The timer thread may be late on
+   a loaded host, but never early.  */
+
+static UINT    fired_check(ULONG fired, ULONG expected)
+{
+
+    return((fired >= expected) && (fired <= (expected + 2)));
+}
+
+
+/* Return the remaining ticks of a timer.  */
+
+static ULONG   remaining_get(TX_TIMER *timer_ptr)
+{
+
+ULONG   remaining_ticks;
+
+
+    tx_timer_info_get(timer_ptr, TX_NULL, TX_NULL, &remaining_ticks, TX_NULL, TX_NULL);
+    return(remaining_ticks);
+}
+
+
+/* Define the test threads.  */
+
+static void    thread_0_entry(ULONG thread_input)
+{
+
+UINT        status;
+UINT        old_posture;
+ULONG       i;
+ULONG       start;
+ULONG       now;
+ULONG       next;
+ULONG       ticks;
+ULONG       activate_time;
+ULONG       deactivate_time;
+ULONG       thread_time;
+clockid_t   timer_thread_clock;
+#ifdef TX_TIMER_ENABLE_PERFORMANCE_INFO
+ULONG       adjustments;
+#endif
+
+
+    /* Inform user.  */
+    printf("Running Timer Hierarchical Wheel Test............................... ");
+
+    /* Start all the one-shot and periodic timers on the same tick.  */
+    old_posture =  tx_interrupt_control(TX_INT_DISABLE);
+    start =  tx_time_get();
+    status =  TX_SUCCESS;
+    for (i = 0; i < TEST_ACCURACY_TIMERS; i++)
+    {
+
+        ticks =  1 + ((i * 37) % TEST_ACCURACY_MAX);
+        accuracy_expected[i] =  start + ticks;
+        status +=  tx_timer_create(&accuracy_timer[i], "accuracy", accuracy_expiration, i, ticks, 0, TX_AUTO_ACTIVATE);
+    }
+    for (i = 0; i < TEST_PERIODIC_TIMERS; i++)
+    {
+
+        status +=  tx_timer_create(&periodic_timer[i], "periodic", periodic_expiration, i, 40 + i, 45 + i, TX_AUTO_ACTIVATE);
+    }
+    tx_interrupt_control(old_posture);
+
+    /* Check status.  */
+    if (status != TX_SUCCESS)
+    {
+
+        /* Timer error.  */
+        printf("ERROR #2\n");
+        test_control_return(1);
+    }
+
+    /* Wait for all the one-shot timers.  */
+    tx_thread_sleep(TEST_ACCURACY_MAX + 5);
+
+    /* Check the expiration time of each one-shot timer.  */
+    for (i = 0; i < TEST_ACCURACY_TIMERS; i++)
+    {
+
+        if (!fired_check(accuracy_fired[i], accuracy_expected[i]))
+        {
+
+            /* Timer error.  */
+            printf("ERROR #3\n");
+            test_control_return(1);
+        }
+        tx_timer_delete(&accuracy_timer[i]);
+    }
+
+    /* Check the periodic timers, each expiration must happen one period after the previous one.  */
+    for (i = 0; i < TEST_PERIODIC_TIMERS; i++)
+    {
+
+        tx_timer_delete(&periodic_timer[i]);
+        if ((periodic_count[i] < 5) || (!fired_check(periodic_first[i], start + 40 + i)) ||
+            (!fired_check(periodic_last[i], periodic_first[i] + ((periodic_count[i] - 1) * (45 + i)))))
+        {
+
+            /* Timer error.  */
+            printf("ERROR #4\n");
+            test_control_return(1);
+        }
+    }
+
+    /* Start timers on every level of the wheel and past its range, and check the remaining ticks.  */
+    old_posture =  tx_interrupt_control(TX_INT_DISABLE);
+    start =  tx_time_get();
+    status =   tx_timer_create(&long_timer[0], "long 0", long_expiration, 0, 2000, 0, TX_AUTO_ACTIVATE);
+    status +=  tx_timer_create(&long_timer[1], "long 1", long_expiration, 1, 100000, 0, TX_AUTO_ACTIVATE);
+    status +=  tx_timer_create(&long_timer[2], "long 2", long_expiration, 2, 5000000, 0, TX_AUTO_ACTIVATE);
+    if ((status != TX_SUCCESS) || (remaining_get(&long_timer[0]) != 2000) ||
+        (remaining_get(&long_timer[1]) != 100000) || (remaining_get(&long_timer[2]) != 5000000))
+    {
+
+        /* Timer error.  */
+        printf("ERROR #5\n");
+        test_control_return(1);
+    }
+    tx_interrupt_control(old_posture);
+
+    /* Let the wheel turn.  */
+    tx_thread_sleep(70);
+
+    /* The remaining ticks follow the time.  */
+    old_posture =  tx_interrupt_control(TX_INT_DISABLE);
+    now =  tx_time_get() - start;
+    if ((remaining_get(&long_timer[0]) != (2000 - now)) || (remaining_get(&long_timer[1]) != (100000 - now)) ||
+        (remaining_get(&long_timer[2]) != (5000000 - now)))
+    {
+
+        /* Timer error.  */
+        printf("ERROR #6\n");
+        test_control_return(1);
+    }
+
+    /* The remaining ticks are kept by a deactivation and a new activation.  */
+    status =   tx_timer_deactivate(&long_timer[1]);
+    status +=  tx_timer_deactivate(&long_timer[2]);
+    if ((status != TX_SUCCESS) || (remaining_get(&long_timer[1]) != (100000 - now)) ||
+        (remaining_get(&long_timer[2]) != (5000000 - now)))
+    {
+
+        /* Timer error.  */
+        printf("ERROR #7\n");
+        test_control_return(1);
+    }
+    status =   tx_timer_activate(&long_timer[1]);
+    status +=  tx_timer_activate(&long_timer[2]);
+    if ((status != TX_SUCCESS) || (remaining_get(&long_timer[1]) != (100000 - now)) ||
+        (remaining_get(&long_timer[2]) != (5000000 - now)))
+    {
+
+        /* Timer error.  */
+        printf("ERROR #8\n");
+        test_control_return(1);
+    }
+    tx_interrupt_control(old_posture);
+
+    /* Check the next expiration and the time increment of the low power utility with
+       a short timer and a long timer.  */
+    old_posture =  tx_interrupt_control(TX_INT_DISABLE);
+    status =   tx_timer_delete(&long_timer[0]);
+    status +=  tx_timer_delete(&long_timer[2]);
+    status +=  tx_timer_deactivate(&long_timer[1]);
+    status +=  tx_timer_change(&long_timer[1], 3000, 0);
+    status +=  tx_timer_activate(&long_timer[1]);
+    status +=  tx_timer_create(&long_timer[0], "long 0", long_expiration, 0, 70, 0, TX_AUTO_ACTIVATE);
+    start =  tx_time_get();
+    if ((status != TX_SUCCESS) || (tx_timer_get_next(&next) != TX_TRUE) || (next != 69))
+    {
+
+        /* Timer error.  */
+        printf("ERROR #9\n");
+        test_control_return(1);
+    }
+    tx_timer_delete(&long_timer[0]);
+    if ((tx_timer_get_next(&next) != TX_TRUE) || (next != 2999))
+    {
+
+        /* Timer error.  */
+        printf("ERROR #10\n");
+        test_control_return(1);
+    }
+
+    /* Sleep until 50 ticks before the expiration.  */
+    tx_time_increment(2950);
+    if ((tx_time_get() != (start + 2950)) || (tx_timer_get_next(&next) != TX_TRUE) || (next != 49) ||
+        (remaining_get(&long_timer[1]) != 50))
+    {
+
+        /* Timer error.  */
+        printf("ERROR #11\n");
+        test_control_return(1);
+    }
+    tx_interrupt_control(old_posture);
+
+    /* Wait for the expiration.  */
+    tx_thread_sleep(55);
+    if ((!fired_check(long_fired, start + 3000)) || (tx_timer_get_next(&next) != TX_FALSE))
+    {
+
+        /* Timer error.  */
+        printf("ERROR #12\n");
+        test_control_return(1);
+    }
+    tx_timer_delete(&long_timer[1]);
+
+    /* Create the benchmark timers.  */
+    for (i = 0; i < TEST_BENCH_TIMERS; i++)
+    {
+
+        ticks =  1000 + (random_get() % 1000000);
+        status =  tx_timer_create(&bench_timer[i], "bench", long_expiration, i, ticks, 0, TX_NO_ACTIVATE);
+        if (status != TX_SUCCESS)
+        {
+
+            /* Timer error.  */
+            printf("ERROR #13\n");
+            test_control_return(1);
+        }
+    }
+
+    /* Activate all of them.  */
+    activate_time =  time_get(CLOCK_MONOTONIC);
+    for (i = 0; i < TEST_BENCH_TIMERS; i++)
+    {
+
+        tx_timer_activate(&bench_timer[i]);
+    }
+    activate_time =  time_get(CLOCK_MONOTONIC) - activate_time;
+
+    /* Measure the processing time of the timer thread while they are active.  */
+    pthread_getcpuclockid(_tx_timer_thread.tx_thread_linux_thread_id, &timer_thread_clock);
+#ifdef TX_TIMER_ENABLE_PERFORMANCE_INFO
+    adjustments =  _tx_timer_performance__expiration_adjust_count;
+#endif
+    thread_time =  time_get(timer_thread_clock);
+    tx_thread_sleep(TEST_BENCH_TICKS);
+    thread_time =  time_get(timer_thread_clock) - thread_time;
+#ifdef TX_TIMER_ENABLE_PERFORMANCE_INFO
+    adjustments =  _tx_timer_performance__expiration_adjust_count - adjustments;
+#endif
+
+    /* Deactivate all of them.  */
+    deactivate_time =  time_get(CLOCK_MONOTONIC);
+    for (i = 0; i < TEST_BENCH_TIMERS; i++)
+    {
+
+        tx_timer_deactivate(&bench_timer[i]);
+    }
+    deactivate_time =  time_get(CLOCK_MONOTONIC) - deactivate_time;
+
+    /* None of them may have expired.  */
+    for (i = 0; i < TEST_BENCH_TIMERS; i++)
+    {
+
+        if (remaining_get(&bench_timer[i]) == 0)
+        {
+
+            /* Timer error.  */
+            printf("ERROR #14\n");
+            test_control_return(1);
+        }
+        tx_timer_delete(&bench_timer[i]);
+    }
+
+#if defined(TX_TIMER_ENABLE_HIERARCHICAL_WHEEL) && defined(TX_TIMER_ENABLE_PERFORMANCE_INFO)
+
+    /* On the wheel, a long timer is only moved when its slot is due, not every turn of
+       the timer list.  */
+    if (adjustments > (TEST_BENCH_TIMERS / 8))
+    {
+
+        /* Timer error.  */
+        printf("ERROR #15\n");
+        test_control_return(1);
+    }
+#endif
+
+    /* Successful test.  */
+    printf("SUCCESS!\n");
+
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+    printf("    timing wheel, %d timers\n", TEST_BENCH_TIMERS);
+#else
+    printf("    timer list, %d timers\n", TEST_BENCH_TIMERS);
+#endif
+    printf("    activate %lu ns, deactivate %lu ns, timer thread %lu ns per tick\n",
+           (unsigned long) (activate_time / TEST_BENCH_TIMERS), (unsigned long) (deactivate_time / TEST_BENCH_TIMERS),
+           (unsigned long) (thread_time / TEST_BENCH_TICKS));
+#ifdef TX_TIMER_ENABLE_PERFORMANCE_INFO
+    printf("    %lu expiration adjustments in %d ticks\n", (unsigned long) adjustments, TEST_BENCH_TICKS);
+#endif
+
+    test_control_return(0);
+}
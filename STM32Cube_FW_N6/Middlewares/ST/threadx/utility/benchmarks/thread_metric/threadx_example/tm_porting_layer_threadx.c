@@ -266,6 +266,68 @@ UINT    status;
 }
 
 
+/* This function creates the specified queue of pointers.  If successful, the function
+   should return TM_SUCCESS. Otherwise, TM_ERROR should be returned.  */
+int  tm_pointer_queue_create(int queue_id)
+{
+
+UINT    status;
+
+
+    /* Create the specified queue with pointer messages.  */
+    status =  tx_queue_create(&tm_queue_array[queue_id], "Thread-Metric test", TX_POINTER_ULONG,
+                              &tm_queue_memory_area[queue_id*TM_THREADX_QUEUE_SIZE], TM_THREADX_QUEUE_SIZE);
+
+    /* Determine if the queue create was successful.  */
+    if (status == TX_SUCCESS)
+        return(TM_SUCCESS);
+    else
+        return(TM_ERROR);
+}
+
+
+/* This function sends the specified number of pointers to the specified queue of
+   pointers.  If all the pointers are sent, the function should return TM_SUCCESS.
+   Otherwise, TM_ERROR should be returned.  */
+int  tm_pointer_queue_send(int queue_id, void **pointer_array, int count)
+{
+
+UINT    status;
+UINT    actual_count;
+
+
+    /* Send the pointers to the specified queue in one call.  */
+    status =  tx_queue_pointer_send(&tm_queue_array[queue_id], pointer_array, (UINT) count, &actual_count, TX_NO_WAIT);
+
+    /* Determine if all the pointers were sent.  */
+    if ((status == TX_SUCCESS) && (actual_count == (UINT) count))
+        return(TM_SUCCESS);
+    else
+        return(TM_ERROR);
+}
+
+
+/* This function receives the specified number of pointers from the specified queue of
+   pointers.  If all the pointers are received, the function should return TM_SUCCESS.
+   Otherwise, TM_ERROR should be returned.  */
+int  tm_pointer_queue_receive(int queue_id, void **pointer_array, int count)
+{
+
+UINT    status;
+UINT    actual_count;
+
+
+    /* Receive the pointers from the specified queue in one call.  */
+    status =  tx_queue_pointer_receive(&tm_queue_array[queue_id], pointer_array, (UINT) count, &actual_count, TX_NO_WAIT);
+
+    /* Determine if all the pointers were received.  */
+    if ((status == TX_SUCCESS) && (actual_count == (UINT) count))
+        return(TM_SUCCESS);
+    else
+        return(TM_ERROR);
+}
+
+
 /* This function creates the specified semaphore.  If successful, the function should
    return TM_SUCCESS. Otherwise, TM_ERROR should be returned.  */
 int  tm_semaphore_create(int semaphore_id)
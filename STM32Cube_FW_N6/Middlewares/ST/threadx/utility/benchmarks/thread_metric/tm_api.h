@@ -85,6 +85,9 @@ void   tm_thread_sleep(int seconds);
 int    tm_queue_create(int queue_id);
 int    tm_queue_send(int queue_id, unsigned long *message_ptr);
 int    tm_queue_receive(int queue_id, unsigned long *message_ptr);
+int    tm_pointer_queue_create(int queue_id);
+int    tm_pointer_queue_send(int queue_id, void **pointer_array, int count);
+int    tm_pointer_queue_receive(int queue_id, void **pointer_array, int count);
 int    tm_semaphore_create(int semaphore_id);
 int    tm_semaphore_get(int semaphore_id);
 int    tm_semaphore_put(int semaphore_id);
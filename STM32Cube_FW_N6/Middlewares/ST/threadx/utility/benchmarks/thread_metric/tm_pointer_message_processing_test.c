@@ -0,0 +1,182 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** Thread-Metric Component                                               */
+/**                                                                       */
+/**   Pointer Message Processing Test                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUCTION                                                RELEASE        */
+/*                                                                        */
+/*    tm_pointer_message_processing_test                  PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    Message exchange processing test with batches of pointers. The      */
+/*    counter is in messages, to compare with the message processing      */
+/*    test.                                                               */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+#include "tm_api.h"
+
+
+/* Define the number of pointers sent and received per call. This can be changed
+   with a -D compiler option, 1 to 16.  */
+
+#ifndef TM_POINTER_QUEUE_BATCH
+#define TM_POINTER_QUEUE_BATCH  8
+#endif
+
+
+/* Define the counters used in the demo application...  */
+
+unsigned long   tm_pointer_message_processing_counter;
+unsigned char   tm_pointer_message_buffers[TM_POINTER_QUEUE_BATCH][16];
+void            *tm_pointer_message_sent[TM_POINTER_QUEUE_BATCH];
+void            *tm_pointer_message_received[TM_POINTER_QUEUE_BATCH];
+
+
+/* Define the test thread prototypes.  */
+
+void            tm_pointer_message_processing_thread_0_entry(void);
+
+
+/* Define the reporting thread prototype.  */
+
+void            tm_pointer_message_processing_thread_report(void);
+
+
+/* Define the initialization prototype.  */
+
+void            tm_pointer_message_processing_initialize(void);
+
+
+/* Define main entry point.  */
+
+void tm_main()
+{
+
+    /* Initialize the test.  */
+    tm_initialize(tm_pointer_message_processing_initialize);
+}
+
+
+/* Define the pointer message processing test initialization.  */
+
+void  tm_pointer_message_processing_initialize(void)
+{
+
+    /* Create thread 0 at priority 10.  */
+    tm_thread_create(0, 10, tm_pointer_message_processing_thread_0_entry);
+
+    /* Resume thread 0.  */
+    tm_thread_resume(0);
+
+    /* Create a queue of pointers for the message passing.  */
+    tm_pointer_queue_create(0);
+
+    /* Create the reporting thread. It will preempt the other
+       threads and print out the test results.  */
+    tm_thread_create(5, 2, tm_pointer_message_processing_thread_report);
+    tm_thread_resume(5);
+}
+
+
+/* Define the pointer message processing thread.  */
+void  tm_pointer_message_processing_thread_0_entry(void)
+{
+
+int     i;
+
+
+    /* Initialize the pointers to the message buffers.  */
+    for (i = 0; i < TM_POINTER_QUEUE_BATCH; i++)
+        tm_pointer_message_sent[i] =  (void *) tm_pointer_message_buffers[i];
+
+    while(1)
+    {
+        /* Send a batch of pointers to the queue.  */
+        tm_pointer_queue_send(0, tm_pointer_message_sent, TM_POINTER_QUEUE_BATCH);
+
+        /* Receive the batch of pointers from the queue.  */
+        tm_pointer_queue_receive(0, tm_pointer_message_received, TM_POINTER_QUEUE_BATCH);
+
+        /* Check for invalid messages.  */
+        if (tm_pointer_message_received[TM_POINTER_QUEUE_BATCH - 1] != tm_pointer_message_sent[TM_POINTER_QUEUE_BATCH - 1])
+            break;
+
+        /* Touch the last buffer of the batch.  */
+        tm_pointer_message_buffers[TM_POINTER_QUEUE_BATCH - 1][15]++;
+
+        /* Increment the number of messages sent and received.  */
+        tm_pointer_message_processing_counter =  tm_pointer_message_processing_counter + TM_POINTER_QUEUE_BATCH;
+    }
+}
+
+
+/* Define the pointer message test reporting thread.  */
+void  tm_pointer_message_processing_thread_report(void)
+{
+
+unsigned long   last_counter;
+unsigned long   relative_time;
+
+
+    /* Initialize the last counter.  */
+    last_counter =  0;
+
+    /* Initialize the relative time.  */
+    relative_time =  0;
+
+    while(1)
+    {
+
+        /* Sleep to allow the test to run.  */
+        tm_thread_sleep(TM_TEST_DURATION);
+
+        /* Increment the relative time.  */
+        relative_time =  relative_time + TM_TEST_DURATION;
+
+        /* Print results to the stdio window.  */
+        printf("**** Thread-Metric Pointer Message Processing Test **** Relative Time: %lu\n", relative_time);
+
+        /* See if there are any errors.  */
+        if (tm_pointer_message_processing_counter == last_counter)
+        {
+
+            printf("ERROR: Invalid counter value(s). Error sending/receiving messages!\n");
+        }
+
+        /* Show the time period total.  */
+        printf("Time Period Total:  %lu\n\n", tm_pointer_message_processing_counter - last_counter);
+
+        /* Save the last counter.  */
+        last_counter =  tm_pointer_message_processing_counter;
+    }
+}
@@ -100,6 +100,32 @@ int  tm_queue_receive(int queue_id, unsigned long *message_ptr)
 }
 
 
+/* This function creates the specified queue of pointers.  If successful, the function
+   should return TM_SUCCESS. Otherwise, TM_ERROR should be returned.  */
+int  tm_pointer_queue_create(int queue_id)
+{
+
+}
+
+
+/* This function sends the specified number of pointers to the specified queue of
+   pointers.  If all the pointers are sent, the function should return TM_SUCCESS.
+   Otherwise, TM_ERROR should be returned.  */
+int  tm_pointer_queue_send(int queue_id, void **pointer_array, int count)
+{
+
+}
+
+
+/* This function receives the specified number of pointers from the specified queue of
+   pointers.  If all the pointers are received, the function should return TM_SUCCESS.
+   Otherwise, TM_ERROR should be returned.  */
+int  tm_pointer_queue_receive(int queue_id, void **pointer_array, int count)
+{
+
+}
+
+
 /* This function creates the specified semaphore.  If successful, the function should
    return TM_SUCCESS. Otherwise, TM_ERROR should be returned.  */
 int  tm_semaphore_create(int semaphore_id)
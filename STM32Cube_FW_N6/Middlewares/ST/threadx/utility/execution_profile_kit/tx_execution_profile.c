@@ -103,6 +103,47 @@ ULONG                                   _tx_execution_isr_nest_counter = 0;
 #endif
 
 
+#ifdef TX_EXECUTION_PROFILE_ENABLE_HISTOGRAMS
+
+/* Define the thread control block ID, as in tx_thread.h, to check the owner of a thread profile
+   record.  */
+
+#ifndef TX_THREAD_ID
+#define TX_THREAD_ID                            ((ULONG) 0x54485244)
+#endif
+
+
+/* Define the thread profile records. The threads scheduled once all the records are used
+   share the last record.  */
+
+TX_EXECUTION_THREAD_PROFILE             _tx_execution_thread_profiles[TX_EXECUTION_PROFILE_THREADS + 1];
+
+
+/* Define the ISR profile record and the ISR nesting information. Every ISR is accounted,
+   whatever its nesting level.  */
+
+TX_EXECUTION_ISR_PROFILE                _tx_execution_isr_profile;
+ULONG                                   _tx_execution_isr_nest_level;
+EXECUTION_TIME_SOURCE_TYPE              _tx_execution_isr_level_start;
+EXECUTION_TIME_SOURCE_TYPE              _tx_execution_isr_outer_start;
+
+
+/* Define internal functions of the extended profile.  */
+
+EXECUTION_TIME                          _tx_execution_time_delta(EXECUTION_TIME_SOURCE_TYPE start_time, EXECUTION_TIME_SOURCE_TYPE current_time);
+VOID                                    _tx_execution_histogram_update(ULONG *histogram, EXECUTION_TIME *max_time, EXECUTION_TIME delta_time);
+TX_EXECUTION_THREAD_PROFILE             *_tx_execution_thread_profile_find(TX_THREAD *thread_ptr);
+VOID                                    _tx_execution_thread_slice_start(TX_THREAD *thread_ptr, EXECUTION_TIME_SOURCE_TYPE current_time);
+VOID                                    _tx_execution_thread_slice_end(TX_THREAD *thread_ptr, EXECUTION_TIME_SOURCE_TYPE current_time);
+VOID                                    _tx_execution_isr_nesting_enter(VOID);
+VOID                                    _tx_execution_isr_nesting_exit(VOID);
+UINT                                    _tx_execution_report_start(CHAR *line, CHAR *type);
+UINT                                    _tx_execution_report_string(CHAR *line, UINT index, CHAR *string);
+UINT                                    _tx_execution_report_number(CHAR *line, UINT index, EXECUTION_TIME value);
+UINT                                    _tx_execution_report_histogram(CHAR *line, UINT index, ULONG *histogram);
+#endif
+
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
@@ -174,7 +215,7 @@ VOID  _tx_execution_initialize(void)
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    [_tx_execution_thread_slice_start]    Start thread run slice        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -210,6 +251,12 @@ EXECUTION_TIME              new_total_time;
     /* This thread is being scheduled.  Simply setup the last start time in the
        thread control block.  */
     thread_ptr -> tx_thread_execution_time_last_start =  current_time;
+
+#ifdef TX_EXECUTION_PROFILE_ENABLE_HISTOGRAMS
+
+    /* Record the ready-to-running latency and start the run slice.  */
+    _tx_execution_thread_slice_start(thread_ptr, current_time);
+#endif
     
     /* Pickup the last idle start time.  */
     last_start_time =  _tx_execution_idle_time_last_start;
@@ -279,7 +326,7 @@ EXECUTION_TIME              new_total_time;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    [_tx_execution_thread_slice_end]      End thread run slice          */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -372,6 +419,12 @@ EXECUTION_TIME              delta_time;
             _tx_execution_thread_time_total =  new_total_time;
         }
 
+#ifdef TX_EXECUTION_PROFILE_ENABLE_HISTOGRAMS
+
+        /* Record the run slice of the thread.  */
+        _tx_execution_thread_slice_end(thread_ptr, current_time);
+#endif
+
         /* Is the system now idle?  */
         if (_tx_thread_execute_ptr == TX_NULL)
         {
@@ -407,7 +460,7 @@ EXECUTION_TIME              delta_time;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    [_tx_execution_isr_nesting_enter]     ISR nesting level increase    */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -438,6 +491,11 @@ EXECUTION_TIME              delta_time;
     _tx_execution_isr_nest_counter++;
 #endif
 
+#ifdef TX_EXECUTION_PROFILE_ENABLE_HISTOGRAMS
+    /* Account the time of the ISR nesting level left.  */
+    _tx_execution_isr_nesting_enter();
+#endif
+
     /* Determine if this is the first interrupt. Nested interrupts are all treated as
        general interrupt processing.  */
 #ifdef TX_CORTEX_M_EPK
@@ -585,7 +643,8 @@ EXECUTION_TIME              delta_time;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    [_tx_execution_isr_nesting_exit]      ISR nesting level decrease    */
+/*    [_tx_execution_thread_slice_end]      End thread run slice          */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -612,6 +671,11 @@ EXECUTION_TIME_SOURCE_TYPE  current_time;
 EXECUTION_TIME              delta_time;
 
 
+#ifdef TX_EXECUTION_PROFILE_ENABLE_HISTOGRAMS
+    /* Account the time of the ISR nesting level left.  */
+    _tx_execution_isr_nesting_exit();
+#endif
+
     /* Determine if this is the first interrupt. Nested interrupts are all treated as 
        general interrupt processing.  */
 #ifdef TX_CORTEX_M_EPK
@@ -672,6 +736,14 @@ EXECUTION_TIME              delta_time;
                 /* Yes, setup the thread last start time in the thread control block.  */
                 thread_ptr -> tx_thread_execution_time_last_start =  current_time;
             }
+#ifdef TX_EXECUTION_PROFILE_ENABLE_HISTOGRAMS
+            else
+            {
+
+                /* The thread is preempted, record its run slice.  */
+                _tx_execution_thread_slice_end(thread_ptr, current_time);
+            }
+#endif
         }
         
         /* Determine if the system is now idle.  */
@@ -1097,4 +1169,1266 @@ UINT  _tx_execution_idle_time_get(EXECUTION_TIME *total_time)
 }
 
 
+#ifdef TX_EXECUTION_PROFILE_ENABLE_HISTOGRAMS
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_time_delta                            PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes the time elapsed between two readings of     */
+/*    the time source, assuming an incrementing time counter.             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    start_time                        Start time                        */
+/*    current_time                      Current time                      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    delta_time                        Elapsed time                      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Execution profile kit                                               */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+EXECUTION_TIME  _tx_execution_time_delta(EXECUTION_TIME_SOURCE_TYPE start_time, EXECUTION_TIME_SOURCE_TYPE current_time)
+{
+
+EXECUTION_TIME              delta_time;
+
+
+    /* Determine how to calculate the difference.  */
+    if (current_time >= start_time)
+    {
+
+        /* Simply subtract.  */
+        delta_time =  (EXECUTION_TIME) (current_time - start_time);
+    }
+    else
+    {
+
+        /* Timer wrapped, compute the delta assuming incrementing time counter.  */
+        delta_time =  (EXECUTION_TIME) (current_time + ((((EXECUTION_TIME_SOURCE_TYPE) TX_EXECUTION_MAX_TIME_SOURCE) + 1) - start_time));
+    }
+
+    /* Return the elapsed time.  */
+    return(delta_time);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_histogram_update                      PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function counts a time in its histogram bin, the bin of its    */
+/*    most significant bit, and updates the maximum time.                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    histogram                         Pointer to histogram              */
+/*    max_time                          Pointer to maximum time           */
+/*    delta_time                        Time to count                     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Execution profile kit                                               */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_execution_histogram_update(ULONG *histogram, EXECUTION_TIME *max_time, EXECUTION_TIME delta_time)
+{
+
+EXECUTION_TIME              remaining_time;
+UINT                        bin;
+
+
+    /* Find the most significant bit of the time.  */
+    remaining_time =  delta_time;
+    bin =  ((UINT) 0);
+    while ((remaining_time > ((EXECUTION_TIME) 1)) && (bin < ((UINT) (TX_EXECUTION_PROFILE_HISTOGRAM_BINS - 1))))
+    {
+
+        /* Move to the next bin.  */
+        remaining_time =  remaining_time >> 1;
+        bin++;
+    }
+
+    /* Count the time.  */
+    histogram[bin]++;
+
+    /* Update the maximum time.  */
+    if (delta_time > *max_time)
+    {
+
+        *max_time =  delta_time;
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_thread_profile_find                   PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the profile record of a thread. A thread      */
+/*    gets a record the first time it is scheduled: a free record, or     */
+/*    the record of a deleted thread, or else the record shared by the    */
+/*    other threads.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to thread                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    profile_ptr                       Pointer to profile record         */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_execution_thread_slice_start  Start thread run slice            */
+/*    _tx_execution_thread_slice_end    End thread run slice              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+TX_EXECUTION_THREAD_PROFILE  *_tx_execution_thread_profile_find(TX_THREAD *thread_ptr)
+{
+
+TX_EXECUTION_THREAD_PROFILE *profile_ptr;
+TX_THREAD                   *owner_ptr;
+UINT                        index;
+
+
+    /* Pickup the profile record of the thread.  */
+    profile_ptr =  thread_ptr -> tx_thread_execution_profile_ptr;
+
+    /* Determine if the thread has a record yet.  */
+    if (profile_ptr == TX_NULL)
+    {
+
+        /* No, default to the record shared by the other threads.  */
+        profile_ptr =  &_tx_execution_thread_profiles[TX_EXECUTION_PROFILE_THREADS];
+
+        /* Look for a record that is not used or whose thread was deleted.  */
+        for (index = ((UINT) 0); index < ((UINT) TX_EXECUTION_PROFILE_THREADS); index++)
+        {
+
+            /* Pickup the owner of this record.  */
+            owner_ptr =  _tx_execution_thread_profiles[index].tx_execution_profile_thread;
+
+            /* Determine if the record is available.  */
+            if ((owner_ptr == TX_NULL) || (owner_ptr -> tx_thread_id != TX_THREAD_ID) ||
+                (owner_ptr -> tx_thread_execution_profile_ptr != &_tx_execution_thread_profiles[index]))
+            {
+
+                /* Yes, clear the record and give it to the thread.  */
+                profile_ptr =  &_tx_execution_thread_profiles[index];
+                TX_MEMSET(profile_ptr, 0, (sizeof(TX_EXECUTION_THREAD_PROFILE)));
+                profile_ptr -> tx_execution_profile_thread =  thread_ptr;
+                break;
+            }
+        }
+
+        /* Remember the record of the thread.  */
+        thread_ptr -> tx_thread_execution_profile_ptr =  profile_ptr;
+    }
+
+    /* Return the profile record.  */
+    return(profile_ptr);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_thread_ready                          PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is called when a thread becomes ready. It saves the   */
+/*    start of the ready period, unless the thread is still running.      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to thread                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    TX_THREAD_STATE_CHANGE            Thread state change macro         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_execution_thread_ready(TX_THREAD *thread_ptr)
+{
+
+    /* Determine if the thread is running or already ready.  */
+    if ((thread_ptr -> tx_thread_execution_slice_start == ((EXECUTION_TIME_SOURCE_TYPE) 0)) &&
+        (thread_ptr -> tx_thread_execution_ready_start == ((EXECUTION_TIME_SOURCE_TYPE) 0)))
+    {
+
+        /* No, save the start of the ready period.  */
+        thread_ptr -> tx_thread_execution_ready_start =  TX_EXECUTION_TIME_SOURCE;
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_thread_slice_start                    PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is called when a thread is scheduled. It counts the   */
+/*    ready-to-running latency of the thread and starts its run slice.    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to thread                 */
+/*    current_time                      Current time                      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_execution_thread_profile_find Find thread profile record        */
+/*    _tx_execution_time_delta          Compute elapsed time              */
+/*    _tx_execution_histogram_update    Count time in histogram           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_execution_thread_enter        Thread execution start            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_execution_thread_slice_start(TX_THREAD *thread_ptr, EXECUTION_TIME_SOURCE_TYPE current_time)
+{
+
+TX_EXECUTION_THREAD_PROFILE *profile_ptr;
+EXECUTION_TIME_SOURCE_TYPE  ready_start;
+
+
+    /* Pickup the profile record of the thread.  */
+    profile_ptr =  _tx_execution_thread_profile_find(thread_ptr);
+
+    /* Pickup the start of the ready period.  */
+    ready_start =  thread_ptr -> tx_thread_execution_ready_start;
+
+    /* Determine if the ready period is known.  */
+    if (ready_start != ((EXECUTION_TIME_SOURCE_TYPE) 0))
+    {
+
+        /* Yes, clear it and count the latency.  */
+        thread_ptr -> tx_thread_execution_ready_start =  ((EXECUTION_TIME_SOURCE_TYPE) 0);
+        _tx_execution_histogram_update(profile_ptr -> tx_execution_profile_ready_histogram,
+                                       &(profile_ptr -> tx_execution_profile_ready_max),
+                                       _tx_execution_time_delta(ready_start, current_time));
+    }
+
+    /* Start the run slice.  */
+    thread_ptr -> tx_thread_execution_slice_start =  current_time;
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_thread_slice_end                      PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is called when a thread is switched out. It counts    */
+/*    the run slice of the thread. A thread that is still ready is        */
+/*    counted as preempted and its ready period starts.                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to thread                 */
+/*    current_time                      Current time                      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_execution_thread_profile_find Find thread profile record        */
+/*    _tx_execution_time_delta          Compute elapsed time              */
+/*    _tx_execution_histogram_update    Count time in histogram           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_execution_thread_exit         Thread execution end              */
+/*    _tx_execution_isr_exit            ISR processing end                */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_execution_thread_slice_end(TX_THREAD *thread_ptr, EXECUTION_TIME_SOURCE_TYPE current_time)
+{
+
+TX_EXECUTION_THREAD_PROFILE *profile_ptr;
+EXECUTION_TIME_SOURCE_TYPE  slice_start;
+
+
+    /* Pickup the start of the run slice.  */
+    slice_start =  thread_ptr -> tx_thread_execution_slice_start;
+
+    /* Determine if the run slice is already counted.  */
+    if (slice_start != ((EXECUTION_TIME_SOURCE_TYPE) 0))
+    {
+
+        /* No, clear the start of the run slice and count it.  */
+        thread_ptr -> tx_thread_execution_slice_start =  ((EXECUTION_TIME_SOURCE_TYPE) 0);
+        profile_ptr =  _tx_execution_thread_profile_find(thread_ptr);
+        _tx_execution_histogram_update(profile_ptr -> tx_execution_profile_slice_histogram,
+                                       &(profile_ptr -> tx_execution_profile_slice_max),
+                                       _tx_execution_time_delta(slice_start, current_time));
+
+        /* Determine if the thread is switched out while still ready.  */
+        if (thread_ptr -> tx_thread_state == TX_READY)
+        {
+
+            /* Yes, count the preemption and start the ready period.  */
+            profile_ptr -> tx_execution_profile_preemptions++;
+            thread_ptr -> tx_thread_execution_ready_start =  current_time;
+        }
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_isr_nesting_enter                     PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is called whenever ISR processing starts, at any      */
+/*    nesting level. It accounts the time of the nesting level left and   */
+/*    counts the ISR.                                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_execution_time_delta          Compute elapsed time              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_execution_isr_enter           ISR processing start              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_execution_isr_nesting_enter(VOID)
+{
+
+EXECUTION_TIME_SOURCE_TYPE  current_time;
+ULONG                       level;
+ULONG                       slot;
+
+
+    /* Pickup the current time.  */
+    current_time =  TX_EXECUTION_TIME_SOURCE;
+
+    /* Pickup the current nesting level.  */
+    level =  _tx_execution_isr_nest_level;
+
+    /* Determine if this ISR interrupts a thread or another ISR.  */
+    if (level == ((ULONG) 0))
+    {
+
+        /* A thread, this ISR is an outermost ISR.  */
+        _tx_execution_isr_outer_start =  current_time;
+        _tx_execution_isr_profile.tx_execution_isr_profile_count++;
+    }
+    else
+    {
+
+        /* Another ISR, account the time of the nesting level left.  */
+        slot =  level - ((ULONG) 1);
+        if (slot >= ((ULONG) TX_EXECUTION_PROFILE_ISR_LEVELS))
+        {
+
+            /* The deeper levels are accounted in the last level.  */
+            slot =  ((ULONG) (TX_EXECUTION_PROFILE_ISR_LEVELS - 1));
+        }
+        _tx_execution_isr_profile.tx_execution_isr_profile_level_time[slot] =
+            _tx_execution_isr_profile.tx_execution_isr_profile_level_time[slot] + _tx_execution_time_delta(_tx_execution_isr_level_start, current_time);
+        _tx_execution_isr_profile.tx_execution_isr_profile_nested_count++;
+    }
+
+    /* Move to the next nesting level.  */
+    level++;
+    _tx_execution_isr_nest_level =  level;
+    _tx_execution_isr_level_start =  current_time;
+
+    /* Update the maximum nesting level.  */
+    if (level > _tx_execution_isr_profile.tx_execution_isr_profile_nesting_max)
+    {
+
+        _tx_execution_isr_profile.tx_execution_isr_profile_nesting_max =  level;
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_isr_nesting_exit                      PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is called whenever ISR processing ends, at any        */
+/*    nesting level. It accounts the time of the nesting level left and,  */
+/*    for an outermost ISR, counts its duration.                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_execution_time_delta          Compute elapsed time              */
+/*    _tx_execution_histogram_update    Count time in histogram           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_execution_isr_exit            ISR processing end                */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_execution_isr_nesting_exit(VOID)
+{
+
+EXECUTION_TIME_SOURCE_TYPE  current_time;
+ULONG                       level;
+ULONG                       slot;
+
+
+    /* Pickup the current nesting level.  */
+    level =  _tx_execution_isr_nest_level;
+
+    /* Determine if the ISR start is known.  */
+    if (level != ((ULONG) 0))
+    {
+
+        /* Pickup the current time.  */
+        current_time =  TX_EXECUTION_TIME_SOURCE;
+
+        /* Account the time of the nesting level left.  */
+        slot =  level - ((ULONG) 1);
+        if (slot >= ((ULONG) TX_EXECUTION_PROFILE_ISR_LEVELS))
+        {
+
+            /* The deeper levels are accounted in the last level.  */
+            slot =  ((ULONG) (TX_EXECUTION_PROFILE_ISR_LEVELS - 1));
+        }
+        _tx_execution_isr_profile.tx_execution_isr_profile_level_time[slot] =
+            _tx_execution_isr_profile.tx_execution_isr_profile_level_time[slot] + _tx_execution_time_delta(_tx_execution_isr_level_start, current_time);
+
+        /* Move to the previous nesting level.  */
+        level--;
+        _tx_execution_isr_nest_level =  level;
+        _tx_execution_isr_level_start =  current_time;
+
+        /* Determine if the outermost ISR ends.  */
+        if (level == ((ULONG) 0))
+        {
+
+            /* Yes, count its duration.  */
+            _tx_execution_histogram_update(_tx_execution_isr_profile.tx_execution_isr_profile_histogram,
+                                           &(_tx_execution_isr_profile.tx_execution_isr_profile_max),
+                                           _tx_execution_time_delta(_tx_execution_isr_outer_start, current_time));
+        }
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_thread_profile_get                    PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function gets a copy of the profile record of the specified    */
+/*    thread. A thread has no record of its own before it is scheduled,   */
+/*    or when it shares the record of the threads that did not fit.       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to thread                 */
+/*    profile_ptr                       Destination for the profile       */
+/*                                        record                          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_thread_profile_get(TX_THREAD *thread_ptr, TX_EXECUTION_THREAD_PROFILE *profile_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_EXECUTION_THREAD_PROFILE *record_ptr;
+UINT                        status;
+
+
+    /* Disable interrupts while the record is copied.  */
+    TX_DISABLE
+
+    /* Pickup the profile record of the thread.  */
+    record_ptr =  thread_ptr -> tx_thread_execution_profile_ptr;
+
+    /* Determine if the thread has a record of its own.  */
+    if ((record_ptr == TX_NULL) || (record_ptr -> tx_execution_profile_thread != thread_ptr))
+    {
+
+        /* No, the profile is not available.  */
+        status =  TX_NOT_AVAILABLE;
+    }
+    else
+    {
+
+        /* Yes, copy the record.  */
+        *profile_ptr =  *record_ptr;
+        status =  TX_SUCCESS;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return completion status.  */
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_isr_profile_get                       PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function gets a copy of the ISR profile record.                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    profile_ptr                       Destination for the profile       */
+/*                                        record                          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_isr_profile_get(TX_EXECUTION_ISR_PROFILE *profile_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts while the record is copied.  */
+    TX_DISABLE
+
+    /* Copy the record.  */
+    *profile_ptr =  _tx_execution_isr_profile;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_profile_reset                         PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function clears the histograms, maximum times and counters of  */
+/*    all the thread profile records and of the ISR profile record. The   */
+/*    threads keep their records.                                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_profile_reset(void)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD                   *owner_ptr;
+UINT                        index;
+
+
+    /* Disable interrupts while the records are cleared.  */
+    TX_DISABLE
+
+    /* Clear the thread profile records, the shared one included.  */
+    for (index = ((UINT) 0); index <= ((UINT) TX_EXECUTION_PROFILE_THREADS); index++)
+    {
+
+        /* Keep the owner of the record.  */
+        owner_ptr =  _tx_execution_thread_profiles[index].tx_execution_profile_thread;
+        TX_MEMSET(&_tx_execution_thread_profiles[index], 0, (sizeof(TX_EXECUTION_THREAD_PROFILE)));
+        _tx_execution_thread_profiles[index].tx_execution_profile_thread =  owner_ptr;
+    }
+
+    /* Clear the ISR profile record.  */
+    TX_MEMSET(&_tx_execution_isr_profile, 0, (sizeof(TX_EXECUTION_ISR_PROFILE)));
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_report_start                          PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function starts a line of the profile report with the TXEP     */
+/*    marker and the type of the line.                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    line                              Report line                       */
+/*    type                              Type of the line                  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    index                             End of the line                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_execution_profile_report      Profile report output             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_report_start(CHAR *line, CHAR *type)
+{
+
+UINT                        index;
+UINT                        length;
+
+
+    /* Start the line with the marker.  */
+    line[0] =  'T';
+    line[1] =  'X';
+    line[2] =  'E';
+    line[3] =  'P';
+    line[4] =  ',';
+    index =  ((UINT) 5);
+
+    /* Append the type of the line.  */
+    length =  ((UINT) 0);
+    while (type[length] != ((CHAR) 0))
+    {
+
+        line[index] =  type[length];
+        index++;
+        length++;
+    }
+
+    /* Return the end of the line.  */
+    return(index);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_report_string                         PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function appends a thread name to a line of the profile        */
+/*    report. The name is truncated to 32 characters and its commas are   */
+/*    replaced.                                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    line                              Report line                       */
+/*    index                             Current end of the line           */
+/*    string                            String to append                  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    index                             New end of the line               */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_execution_profile_report      Profile report output             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_report_string(CHAR *line, UINT index, CHAR *string)
+{
+
+UINT                        length;
+CHAR                        character;
+
+
+    /* Append the field separator.  */
+    line[index] =  ',';
+    index++;
+
+    /* Copy the string, which cannot hold field separators.  */
+    length =  ((UINT) 0);
+    while ((string[length] != ((CHAR) 0)) && (length < ((UINT) 32)))
+    {
+
+        /* Pickup the next character.  */
+        character =  string[length];
+        if ((character == ',') || (character == '\n') || (character == '\r'))
+        {
+
+            /* Replace the field and line separators.  */
+            character =  '_';
+        }
+        line[index] =  character;
+        index++;
+        length++;
+    }
+
+    /* Return the new end of the line.  */
+    return(index);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_report_number                         PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function appends a decimal number to a line of the profile     */
+/*    report, unless the line is full.                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    line                              Report line                       */
+/*    index                             Current end of the line           */
+/*    value                             Number to append                  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    index                             New end of the line               */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_execution_report_histogram    Histogram report output           */
+/*    _tx_execution_profile_report      Profile report output             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_report_number(CHAR *line, UINT index, EXECUTION_TIME value)
+{
+
+CHAR                        digits[20];
+UINT                        count;
+
+
+    /* Determine if the number fits in the line, the separator and 20 digits.  */
+    if ((index + ((UINT) 22)) <= ((UINT) TX_EXECUTION_PROFILE_REPORT_LINE_SIZE))
+    {
+
+        /* Build the digits, least significant first.  */
+        count =  ((UINT) 0);
+        do
+        {
+
+            digits[count] =  (CHAR) ('0' + ((UINT) (value % ((EXECUTION_TIME) 10))));
+            value =  value / ((EXECUTION_TIME) 10);
+            count++;
+        } while (value != ((EXECUTION_TIME) 0));
+
+        /* Append the field separator and the digits.  */
+        line[index] =  ',';
+        index++;
+        while (count != ((UINT) 0))
+        {
+
+            count--;
+            line[index] =  digits[count];
+            index++;
+        }
+    }
+
+    /* Return the new end of the line.  */
+    return(index);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_report_histogram                      PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function appends the bins of a histogram to a line of the      */
+/*    profile report, up to the last bin that is not empty.               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    line                              Report line                       */
+/*    index                             Current end of the line           */
+/*    histogram                         Pointer to histogram              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    index                             New end of the line               */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_execution_report_number       Number report output              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_execution_profile_report      Profile report output             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_report_histogram(CHAR *line, UINT index, ULONG *histogram)
+{
+
+UINT                        bins;
+UINT                        bin;
+
+
+    /* Find the end of the histogram.  */
+    bins =  ((UINT) TX_EXECUTION_PROFILE_HISTOGRAM_BINS);
+    while ((bins != ((UINT) 0)) && (histogram[bins - ((UINT) 1)] == ((ULONG) 0)))
+    {
+
+        bins--;
+    }
+
+    /* Append the bins.  */
+    for (bin = ((UINT) 0); bin < bins; bin++)
+    {
+
+        index =  _tx_execution_report_number(line, index, (EXECUTION_TIME) histogram[bin]);
+    }
+
+    /* Return the new end of the line.  */
+    return(index);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_profile_report                        PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function outputs the extended profile as text lines, for the   */
+/*    tx_execution_profile_report host tool. Each line starts with TXEP   */
+/*    and is passed without end of line to the report function, which is  */
+/*    called with interrupts enabled.                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    report_function                   Line output function              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_execution_report_start        Line start report output          */
+/*    _tx_execution_report_string       String report output              */
+/*    _tx_execution_report_number       Number report output              */
+/*    _tx_execution_report_histogram    Histogram report output           */
+/*    (report_function)                 Line output function              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_profile_report(VOID (*report_function)(CHAR *line))
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_EXECUTION_THREAD_PROFILE profile;
+TX_EXECUTION_ISR_PROFILE    isr_profile;
+TX_THREAD                   *owner_ptr;
+CHAR                        line[TX_EXECUTION_PROFILE_REPORT_LINE_SIZE];
+UINT                        index;
+UINT                        record;
+UINT                        level;
+UINT                        valid;
+
+
+    /* Output the header line with the size of the histograms.  */
+    index =  _tx_execution_report_start(line, "BEGIN");
+    index =  _tx_execution_report_number(line, index, (EXECUTION_TIME) TX_EXECUTION_PROFILE_HISTOGRAM_BINS);
+    index =  _tx_execution_report_number(line, index, (EXECUTION_TIME) TX_EXECUTION_PROFILE_ISR_LEVELS);
+    line[index] =  ((CHAR) 0);
+    (report_function)(line);
+
+    /* Output the thread profile records, the shared one last.  */
+    for (record = ((UINT) 0); record <= ((UINT) TX_EXECUTION_PROFILE_THREADS); record++)
+    {
+
+        /* Disable interrupts while the record is copied.  */
+        TX_DISABLE
+
+        /* Copy the record.  */
+        profile =  _tx_execution_thread_profiles[record];
+        owner_ptr =  profile.tx_execution_profile_thread;
+
+        /* Start the thread line with the thread name, if the record is used.  */
+        valid =  TX_FALSE;
+        if (record == ((UINT) TX_EXECUTION_PROFILE_THREADS))
+        {
+
+            index =  _tx_execution_report_start(line, "THREAD");
+            index =  _tx_execution_report_string(line, index, "(other threads)");
+            valid =  TX_TRUE;
+        }
+        else if ((owner_ptr != TX_NULL) && (owner_ptr -> tx_thread_id == TX_THREAD_ID) &&
+                 (owner_ptr -> tx_thread_execution_profile_ptr == &_tx_execution_thread_profiles[record]))
+        {
+
+            index =  _tx_execution_report_start(line, "THREAD");
+            index =  _tx_execution_report_string(line, index, (owner_ptr -> tx_thread_name != TX_NULL) ? owner_ptr -> tx_thread_name : "(no name)");
+            valid =  TX_TRUE;
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Skip the records that are not used and the empty shared record.  */
+        if ((valid == TX_FALSE) ||
+            ((record == ((UINT) TX_EXECUTION_PROFILE_THREADS)) && (profile.tx_execution_profile_slice_max == ((EXECUTION_TIME) 0)) &&
+             (profile.tx_execution_profile_ready_max == ((EXECUTION_TIME) 0))))
+        {
+
+            continue;
+        }
+
+        /* Complete the thread line with the preemptions and the maximum times.  */
+        index =  _tx_execution_report_number(line, index, (EXECUTION_TIME) profile.tx_execution_profile_preemptions);
+        index =  _tx_execution_report_number(line, index, profile.tx_execution_profile_ready_max);
+        index =  _tx_execution_report_number(line, index, profile.tx_execution_profile_slice_max);
+        line[index] =  ((CHAR) 0);
+        (report_function)(line);
+
+        /* Output the ready-to-running latency histogram.  */
+        index =  _tx_execution_report_start(line, "READY");
+        index =  _tx_execution_report_histogram(line, index, profile.tx_execution_profile_ready_histogram);
+        line[index] =  ((CHAR) 0);
+        (report_function)(line);
+
+        /* Output the run slice histogram.  */
+        index =  _tx_execution_report_start(line, "SLICE");
+        index =  _tx_execution_report_histogram(line, index, profile.tx_execution_profile_slice_histogram);
+        line[index] =  ((CHAR) 0);
+        (report_function)(line);
+    }
+
+    /* Copy the ISR profile record.  */
+    TX_DISABLE
+    isr_profile =  _tx_execution_isr_profile;
+    TX_RESTORE
+
+    /* Output the ISR counters, the time of each nesting level and the ISR duration histogram.  */
+    index =  _tx_execution_report_start(line, "ISR");
+    index =  _tx_execution_report_number(line, index, (EXECUTION_TIME) isr_profile.tx_execution_isr_profile_count);
+    index =  _tx_execution_report_number(line, index, (EXECUTION_TIME) isr_profile.tx_execution_isr_profile_nested_count);
+    index =  _tx_execution_report_number(line, index, (EXECUTION_TIME) isr_profile.tx_execution_isr_profile_nesting_max);
+    index =  _tx_execution_report_number(line, index, isr_profile.tx_execution_isr_profile_max);
+    line[index] =  ((CHAR) 0);
+    (report_function)(line);
+    index =  _tx_execution_report_start(line, "LEVEL");
+    for (level = ((UINT) 0); level < ((UINT) TX_EXECUTION_PROFILE_ISR_LEVELS); level++)
+    {
+
+        index =  _tx_execution_report_number(line, index, isr_profile.tx_execution_isr_profile_level_time[level]);
+    }
+    line[index] =  ((CHAR) 0);
+    (report_function)(line);
+    index =  _tx_execution_report_start(line, "ISRHIST");
+    index =  _tx_execution_report_histogram(line, index, isr_profile.tx_execution_isr_profile_histogram);
+    line[index] =  ((CHAR) 0);
+    (report_function)(line);
+
+    /* Output the end line.  */
+    index =  _tx_execution_report_start(line, "END");
+    line[index] =  ((CHAR) 0);
+    (report_function)(line);
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+#endif
+
+
 #endif /* #if defined(TX_ENABLE_EXECUTION_CHANGE_NOTIFY) || defined(TX_EXECUTION_PROFILE_ENABLE) */
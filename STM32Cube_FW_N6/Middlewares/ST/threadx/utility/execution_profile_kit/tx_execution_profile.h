@@ -44,7 +44,16 @@
     3.  The ThreadX library must be rebuilt with TX_EXECUTION_PROFILE_ENABLE so 
         the assembly code macros are enabled to call the execution profile routines.  
 
-    4.  Add tx_execution_profile.c to the application build.  */
+    4.  Add tx_execution_profile.c to the application build.
+
+    With TX_EXECUTION_PROFILE_ENABLE_HISTOGRAMS also defined for the ThreadX library and
+    tx_execution_profile.c, the kit records for each thread the histograms of its
+    ready-to-running latency and of its run slices, and the number of times it is switched
+    out while still ready. It also records the time spent at each ISR nesting level and the
+    histogram of the ISR durations. All buffers are static: the first
+    TX_EXECUTION_PROFILE_THREADS threads scheduled get their own record, the other threads
+    share one record. _tx_execution_profile_report outputs the records as text lines that
+    tx_execution_profile_report.c, a host tool, turns into a report.  */
 
 /* Define the basic time typedefs for 64-bit accumulation and a 32-bit timer source, which is the
    most common configuration.  */
@@ -86,4 +95,75 @@ UINT  _tx_execution_thread_total_time_get(EXECUTION_TIME *total_time);
 UINT  _tx_execution_isr_time_get(EXECUTION_TIME *total_time);
 UINT  _tx_execution_idle_time_get(EXECUTION_TIME *total_time);
 
+
+#ifdef TX_EXECUTION_PROFILE_ENABLE_HISTOGRAMS
+
+/* Define the size of the extended profile. Bin n of a histogram counts the times from 2^n to
+   2^(n+1) - 1 ticks of the time source, bin 0 also counts 0 and the last bin also counts all
+   the longer times.  */
+
+#ifndef TX_EXECUTION_PROFILE_THREADS
+#define TX_EXECUTION_PROFILE_THREADS            16
+#endif
+#ifndef TX_EXECUTION_PROFILE_HISTOGRAM_BINS
+#define TX_EXECUTION_PROFILE_HISTOGRAM_BINS     32
+#endif
+#ifndef TX_EXECUTION_PROFILE_ISR_LEVELS
+#define TX_EXECUTION_PROFILE_ISR_LEVELS         4
+#endif
+
+
+/* Define the size of a line of the profile report.  */
+
+#define TX_EXECUTION_PROFILE_REPORT_LINE_SIZE   (64 + (21 * TX_EXECUTION_PROFILE_HISTOGRAM_BINS))
+
+
+/* Define the thread profile record. The run slice of a thread goes from the time it is
+   scheduled to the time it is switched out, ISR processing included. A thread that is
+   switched out while still ready (preemption, time-slice or relinquish) is counted as
+   preempted.  */
+
+typedef struct TX_EXECUTION_THREAD_PROFILE_STRUCT
+{
+    struct TX_THREAD_STRUCT     *tx_execution_profile_thread;
+    ULONG                       tx_execution_profile_preemptions;
+    EXECUTION_TIME              tx_execution_profile_ready_max;
+    EXECUTION_TIME              tx_execution_profile_slice_max;
+    ULONG                       tx_execution_profile_ready_histogram[TX_EXECUTION_PROFILE_HISTOGRAM_BINS];
+    ULONG                       tx_execution_profile_slice_histogram[TX_EXECUTION_PROFILE_HISTOGRAM_BINS];
+} TX_EXECUTION_THREAD_PROFILE;
+
+
+/* Define the ISR profile record. The time of each nesting level excludes the nested ISRs,
+   the last level includes all the deeper levels. The duration of an ISR includes its nested
+   ISRs, only the outermost ISRs are in the histogram.  */
+
+typedef struct TX_EXECUTION_ISR_PROFILE_STRUCT
+{
+    ULONG                       tx_execution_isr_profile_count;
+    ULONG                       tx_execution_isr_profile_nested_count;
+    ULONG                       tx_execution_isr_profile_nesting_max;
+    EXECUTION_TIME              tx_execution_isr_profile_max;
+    EXECUTION_TIME              tx_execution_isr_profile_level_time[TX_EXECUTION_PROFILE_ISR_LEVELS];
+    ULONG                       tx_execution_isr_profile_histogram[TX_EXECUTION_PROFILE_HISTOGRAM_BINS];
+} TX_EXECUTION_ISR_PROFILE;
+
+
+/* Record the time a thread becomes ready.  */
+
+#ifndef TX_THREAD_STATE_CHANGE
+#define TX_THREAD_STATE_CHANGE(a, b)            { if ((b) == TX_READY) { _tx_execution_thread_ready(a); } }
+#endif
+
+
+/* Define APIs of the extended profile.  */
+
+VOID  _tx_execution_thread_ready(struct TX_THREAD_STRUCT *thread_ptr);
+UINT  _tx_execution_thread_profile_get(struct TX_THREAD_STRUCT *thread_ptr, TX_EXECUTION_THREAD_PROFILE *profile_ptr);
+UINT  _tx_execution_isr_profile_get(TX_EXECUTION_ISR_PROFILE *profile_ptr);
+UINT  _tx_execution_profile_reset(void);
+UINT  _tx_execution_profile_report(VOID (*report_function)(CHAR *line));
+
+#endif
+
 #endif
@@ -0,0 +1,320 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Utility                                                       */
+/**                                                                       */
+/**   Execution Profile Report (host tool)                                */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* This host tool reads the lines output by _tx_execution_profile_report, from a file
+   or the standard input, and prints the ready-to-running latency and run slice
+   percentiles of each thread and the ISR nesting time. Lines that do not contain
+   "TXEP," are ignored, so a complete console log can be given. The percentiles are
+   the upper bounds of the log2 bins they fall in, limited by the maximum time.
+
+   Build:  cc -O2 -o tx_execution_profile_report tx_execution_profile_report.c
+
+   Usage:  tx_execution_profile_report [-u ticks_per_us] [file]
+
+   Without -u the times are shown in time source ticks. On the ThreadX Linux port the
+   time source counts nanoseconds, use -u 1000 to show microseconds.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#define REPORT_LINE_SIZE        2048
+#define REPORT_MAX_BINS         64
+#define REPORT_MAX_LEVELS       16
+#define REPORT_NAME_SIZE        33
+
+
+/* Define the values of a report line.  */
+
+typedef struct REPORT_VALUES_STRUCT
+{
+    char                *report_values_type;
+    char                *report_values_name;
+    unsigned long long  report_values[REPORT_MAX_BINS];
+    unsigned int        report_values_count;
+} REPORT_VALUES;
+
+
+static double           report_ticks_per_us =  0.0;
+static unsigned int     report_bins =  32;
+static unsigned int     report_levels =  4;
+
+
+/* Split a report line in its type, the thread name and its values.  */
+
+static int  report_line_parse(char *line, REPORT_VALUES *values)
+{
+
+char                *field;
+char                *next;
+
+
+    /* Find the start of the report line.  */
+    field =  strstr(line, "TXEP,");
+    if (field == NULL)
+        return(0);
+    field =  field + 5;
+
+    /* Remove the end of line.  */
+    field[strcspn(field, "\r\n")] =  '\0';
+
+    /* Pickup the type.  */
+    values -> report_values_type =  field;
+    values -> report_values_name =  NULL;
+    values -> report_values_count =  0;
+    next =  strchr(field, ',');
+    if (next == NULL)
+        return(1);
+    *next++ =  '\0';
+
+    /* The thread line starts with the thread name.  */
+    if (strcmp(values -> report_values_type, "THREAD") == 0)
+    {
+
+        values -> report_values_name =  next;
+        next =  strchr(next, ',');
+        if (next == NULL)
+            return(1);
+        *next++ =  '\0';
+    }
+
+    /* Convert the values.  */
+    while ((next != NULL) && (*next != '\0') && (values -> report_values_count < REPORT_MAX_BINS))
+    {
+
+        values -> report_values[values -> report_values_count++] =  strtoull(next, &next, 10);
+        if (*next == ',')
+            next++;
+    }
+
+    return(1);
+}
+
+
+/* Return the time of the percentile of a log2 histogram.  */
+
+static unsigned long long  report_percentile(REPORT_VALUES *histogram, unsigned long long max_time, unsigned int percent)
+{
+
+unsigned long long  total;
+unsigned long long  count;
+unsigned long long  upper;
+unsigned int        bin;
+
+
+    /* Count the samples.  */
+    total =  0;
+    for (bin = 0; bin < histogram -> report_values_count; bin++)
+        total =  total + histogram -> report_values[bin];
+    if (total == 0)
+        return(0);
+
+    /* Find the bin of the percentile, bin n holds the times from 2^n to 2^(n+1)-1.  */
+    count =  0;
+    for (bin = 0; bin < histogram -> report_values_count; bin++)
+    {
+
+        count =  count + histogram -> report_values[bin];
+        if ((count * 100) >= (total * percent))
+            break;
+    }
+
+    /* The last bin has no upper bound.  */
+    if ((bin + 1) >= report_bins)
+        return(max_time);
+    upper =  (2ULL << bin) - 1;
+
+    return((upper < max_time) ? upper : max_time);
+}
+
+
+/* Print a time in ticks or in microseconds.  */
+
+static void  report_time_print(unsigned long long time)
+{
+
+    if (report_ticks_per_us > 0.0)
+        printf(" %10.2f", ((double) time) / report_ticks_per_us);
+    else
+        printf(" %10llu", time);
+}
+
+
+/* Print the percentiles and the maximum of a histogram.  */
+
+static void  report_histogram_print(REPORT_VALUES *histogram, unsigned long long max_time)
+{
+
+unsigned long long  total;
+unsigned int        bin;
+
+
+    total =  0;
+    for (bin = 0; bin < histogram -> report_values_count; bin++)
+        total =  total + histogram -> report_values[bin];
+
+    printf(" %8llu", total);
+    report_time_print(report_percentile(histogram, max_time, 50));
+    report_time_print(report_percentile(histogram, max_time, 90));
+    report_time_print(report_percentile(histogram, max_time, 99));
+    report_time_print(max_time);
+}
+
+
+int  main(int argc, char **argv)
+{
+
+FILE                *file;
+char                line[REPORT_LINE_SIZE];
+char                name[REPORT_NAME_SIZE];
+REPORT_VALUES       values;
+REPORT_VALUES       isr;
+unsigned long long  preemptions =  0;
+unsigned long long  ready_max =  0;
+unsigned long long  slice_max =  0;
+unsigned long long  level_total;
+unsigned int        level;
+unsigned int        reports =  0;
+int                 arg;
+
+
+    /* Parse the options.  */
+    file =  stdin;
+    memset(&isr, 0, sizeof(isr));
+    for (arg = 1; arg < argc; arg++)
+    {
+
+        if ((strcmp(argv[arg], "-u") == 0) && ((arg + 1) < argc))
+        {
+
+            report_ticks_per_us =  atof(argv[++arg]);
+        }
+        else if ((argv[arg][0] != '-') && (file == stdin))
+        {
+
+            file =  fopen(argv[arg], "r");
+            if (file == NULL)
+            {
+
+                perror(argv[arg]);
+                return(1);
+            }
+        }
+        else
+        {
+
+            fprintf(stderr, "Usage: %s [-u ticks_per_us] [file]\n", argv[0]);
+            return(2);
+        }
+    }
+
+    name[0] =  '\0';
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+
+        if (report_line_parse(line, &values) == 0)
+            continue;
+
+        if (strcmp(values.report_values_type, "BEGIN") == 0)
+        {
+
+            /* Pickup the size of the histograms and print the header.  */
+            if (values.report_values_count >= 2)
+            {
+
+                report_bins =     (unsigned int) values.report_values[0];
+                report_levels =   (unsigned int) values.report_values[1];
+            }
+            printf("%sThread                           Preempt |    Ready      p50        p90        p99        max |    Slice      p50        p90        p99        max\n",
+                   (reports != 0) ? "\n" : "");
+            reports++;
+        }
+        else if ((strcmp(values.report_values_type, "THREAD") == 0) && (values.report_values_count >= 3))
+        {
+
+            /* Keep the thread line until its histograms are read.  */
+            snprintf(name, sizeof(name), "%s", (values.report_values_name != NULL) ? values.report_values_name : "");
+            preemptions =  values.report_values[0];
+            ready_max =    values.report_values[1];
+            slice_max =    values.report_values[2];
+        }
+        else if (strcmp(values.report_values_type, "READY") == 0)
+        {
+
+            printf("%-32s %8llu |", name, preemptions);
+            report_histogram_print(&values, ready_max);
+            printf(" |");
+        }
+        else if (strcmp(values.report_values_type, "SLICE") == 0)
+        {
+
+            report_histogram_print(&values, slice_max);
+            printf("\n");
+        }
+        else if (strcmp(values.report_values_type, "ISR") == 0)
+        {
+
+            /* Keep the ISR counters.  */
+            isr =  values;
+        }
+        else if ((strcmp(values.report_values_type, "LEVEL") == 0) && (isr.report_values_count >= 4))
+        {
+
+            /* Print the ISR counters and the share of the ISR time of each nesting level.  */
+            printf("\nISR: %llu interrupts, %llu nested, nesting up to %llu\n",
+                   isr.report_values[0], isr.report_values[1], isr.report_values[2]);
+            level_total =  0;
+            for (level = 0; (level < values.report_values_count) && (level < REPORT_MAX_LEVELS); level++)
+                level_total =  level_total + values.report_values[level];
+            for (level = 0; (level < values.report_values_count) && (level < report_levels); level++)
+            {
+
+                printf("  Level %u%s", level + 1, ((level + 1) == report_levels) ? "+" : " ");
+                report_time_print(values.report_values[level]);
+                printf("  %5.1f%%\n", (level_total != 0) ? (100.0 * (double) values.report_values[level]) / (double) level_total : 0.0);
+            }
+        }
+        else if ((strcmp(values.report_values_type, "ISRHIST") == 0) && (isr.report_values_count >= 4))
+        {
+
+            printf("ISR duration                              |  Samples      p50        p90        p99        max\n");
+            printf("                                          |");
+            report_histogram_print(&values, isr.report_values[3]);
+            printf("\n");
+        }
+    }
+
+    if (file != stdin)
+        fclose(file);
+
+    /* Report an error when no profile was found.  */
+    if (reports == 0)
+    {
+
+        fprintf(stderr, "No execution profile report found\n");
+        return(1);
+    }
+
+    return(0);
+}
@@ -0,0 +1,1444 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Job Pool                                                            */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_job_pool.h"
+
+
+/* Define the mask of the deque indexes.  */
+
+#define TX_JOB_POOL_DEQUE_MASK          ((ULONG) (TX_JOB_POOL_DEQUE_SIZE - 1))
+
+
+/* Define internal job pool function prototypes.  */
+
+TX_JOB_WORKER   *_tx_job_pool_worker_get(TX_JOB_POOL *pool_ptr);
+TX_JOB          *_tx_job_pool_take(TX_JOB_POOL *pool_ptr, TX_JOB_WORKER *worker_ptr);
+UINT            _tx_job_pool_ready(TX_JOB_POOL *pool_ptr, TX_JOB_WORKER *worker_ptr, TX_JOB *job_ptr);
+VOID            _tx_job_execute(TX_JOB_POOL *pool_ptr, TX_JOB_WORKER *worker_ptr, TX_JOB *job_ptr);
+VOID            _tx_job_complete(TX_JOB_POOL *pool_ptr, TX_JOB_WORKER *worker_ptr, TX_JOB *job_ptr);
+VOID            _tx_job_pool_worker_entry(ULONG worker_input);
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    tx_job_pool_create                                  PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function creates a job pool with the specified number of       */
+/*    worker threads. The stack memory is split evenly between the        */
+/*    workers. The workers have the same priority, no time-slice, and     */
+/*    are allowed on all the cores of an SMP system.                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to job pool control       */
+/*                                        block                           */
+/*    name_ptr                          Pointer to job pool name          */
+/*    workers                           Array of worker control blocks    */
+/*    worker_count                      Number of workers                 */
+/*    stack_start                       Start of the stack memory of      */
+/*                                        the workers                     */
+/*    stack_size                        Stack size of each worker         */
+/*    priority                          Priority of the workers           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_event_flags_create             Create wait event flags           */
+/*    tx_semaphore_create               Create idle worker semaphore      */
+/*    tx_thread_create                  Create worker thread              */
+/*    tx_thread_smp_core_exclude        Allow worker on all cores         */
+/*    tx_thread_resume                  Start worker thread               */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+UINT  tx_job_pool_create(TX_JOB_POOL *pool_ptr, CHAR *name_ptr, TX_JOB_WORKER *workers, UINT worker_count,
+                VOID *stack_start, ULONG stack_size, UINT priority)
+{
+
+TX_JOB_WORKER   *worker_ptr;
+UCHAR           *stack_ptr;
+UINT            index;
+UINT            status;
+
+
+    /* Check the pointers and the number of workers.  */
+    if ((pool_ptr == TX_NULL) || (workers == TX_NULL) || (stack_start == TX_NULL))
+    {
+
+        return(TX_PTR_ERROR);
+    }
+    if (worker_count == ((UINT) 0))
+    {
+
+        return(TX_SIZE_ERROR);
+    }
+
+    /* Initialize the job pool control block to all zeros.  */
+    TX_MEMSET(pool_ptr, 0, (sizeof(TX_JOB_POOL)));
+
+    /* Setup the basic job pool fields.  */
+    pool_ptr -> tx_job_pool_name =          name_ptr;
+    pool_ptr -> tx_job_pool_workers =       workers;
+    pool_ptr -> tx_job_pool_worker_count =  worker_count;
+
+    /* Create the semaphore of the idle workers and the event flags of the waiting threads.  */
+    status =  tx_semaphore_create(&pool_ptr -> tx_job_pool_semaphore, name_ptr, 0);
+    if (status == TX_SUCCESS)
+    {
+
+        status =  tx_event_flags_create(&pool_ptr -> tx_job_pool_events, name_ptr);
+    }
+
+    /* Create the worker threads.  */
+    stack_ptr =  TX_VOID_TO_UCHAR_POINTER_CONVERT(stack_start);
+    for (index = ((UINT) 0); (index < worker_count) && (status == TX_SUCCESS); index++)
+    {
+
+        /* Initialize the worker control block to all zeros.  */
+        worker_ptr =  &workers[index];
+        TX_MEMSET(worker_ptr, 0, (sizeof(TX_JOB_WORKER)));
+        worker_ptr -> tx_job_worker_pool =  pool_ptr;
+
+        /* Create the worker thread, which starts when the pool is ready.  */
+        status =  tx_thread_create(&worker_ptr -> tx_job_worker_thread, name_ptr, _tx_job_pool_worker_entry, (ULONG) index,
+                        stack_ptr, stack_size, priority, priority, TX_NO_TIME_SLICE, TX_DONT_START);
+        stack_ptr =  TX_UCHAR_POINTER_ADD(stack_ptr, stack_size);
+
+#ifdef TX_THREAD_SMP_ONLY_CORE_0_DEFAULT
+
+        /* Allow the worker on all the cores.  */
+        if (status == TX_SUCCESS)
+        {
+
+            status =  tx_thread_smp_core_exclude(&worker_ptr -> tx_job_worker_thread, ((ULONG) 0));
+        }
+#endif
+    }
+
+    /* Determine if the job pool could not be created.  */
+    if (status != TX_SUCCESS)
+    {
+
+        return(status);
+    }
+
+    /* The job pool is ready.  */
+    pool_ptr -> tx_job_pool_id =  TX_JOB_POOL_ID;
+
+    /* Start the worker threads.  */
+    for (index = ((UINT) 0); index < worker_count; index++)
+    {
+
+        tx_thread_resume(&workers[index].tx_job_worker_thread);
+    }
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    tx_job_pool_delete                                  PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function deletes a job pool and its worker threads. The jobs   */
+/*    that are not complete are abandoned, and the threads waiting for    */
+/*    them are resumed with the TX_DELETED status.                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to job pool control       */
+/*                                        block                           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_thread_terminate               Terminate worker thread           */
+/*    tx_thread_delete                  Delete worker thread              */
+/*    tx_semaphore_delete               Delete idle worker semaphore      */
+/*    tx_event_flags_delete             Delete wait event flags           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+UINT  tx_job_pool_delete(TX_JOB_POOL *pool_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_JOB_WORKER   *worker_ptr;
+UINT            index;
+
+
+    /* Check the job pool.  */
+    if ((pool_ptr == TX_NULL) || (pool_ptr -> tx_job_pool_id != TX_JOB_POOL_ID))
+    {
+
+        return(TX_PTR_ERROR);
+    }
+
+    /* The job pool cannot be deleted by one of its workers.  */
+    if (_tx_job_pool_worker_get(pool_ptr) != TX_NULL)
+    {
+
+        return(TX_CALLER_ERROR);
+    }
+
+    /* Clear the job pool ID to make it invalid.  */
+    TX_DISABLE
+    pool_ptr -> tx_job_pool_id =  TX_CLEAR_ID;
+    TX_RESTORE
+
+    /* Delete the worker threads.  */
+    for (index = ((UINT) 0); index < pool_ptr -> tx_job_pool_worker_count; index++)
+    {
+
+        worker_ptr =  &pool_ptr -> tx_job_pool_workers[index];
+        tx_thread_terminate(&worker_ptr -> tx_job_worker_thread);
+        tx_thread_delete(&worker_ptr -> tx_job_worker_thread);
+    }
+
+    /* Delete the semaphore and the event flags, which resumes the waiting threads.  */
+    tx_semaphore_delete(&pool_ptr -> tx_job_pool_semaphore);
+    tx_event_flags_delete(&pool_ptr -> tx_job_pool_events);
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    tx_job_pool_info_get                                PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves the number of jobs run by the workers of a  */
+/*    job pool, the number of them stolen from another worker, and the    */
+/*    number of workers waiting for a job.                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to job pool control       */
+/*                                        block                           */
+/*    executed                          Destination for the number of     */
+/*                                        jobs run                        */
+/*    stolen                            Destination for the number of     */
+/*                                        jobs stolen                     */
+/*    idle_count                        Destination for the number of     */
+/*                                        idle workers                    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+UINT  tx_job_pool_info_get(TX_JOB_POOL *pool_ptr, ULONG *executed, ULONG *stolen, ULONG *idle_count)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_JOB_WORKER   *worker_ptr;
+ULONG           executed_total;
+ULONG           stolen_total;
+UINT            index;
+
+
+    /* Check the job pool.  */
+    if ((pool_ptr == TX_NULL) || (pool_ptr -> tx_job_pool_id != TX_JOB_POOL_ID))
+    {
+
+        return(TX_PTR_ERROR);
+    }
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Add up the counters of the workers.  */
+    executed_total =  ((ULONG) 0);
+    stolen_total =    ((ULONG) 0);
+    for (index = ((UINT) 0); index < pool_ptr -> tx_job_pool_worker_count; index++)
+    {
+
+        worker_ptr =      &pool_ptr -> tx_job_pool_workers[index];
+        executed_total =  executed_total + worker_ptr -> tx_job_worker_executed;
+        stolen_total =    stolen_total + worker_ptr -> tx_job_worker_stolen;
+    }
+
+    /* Retrieve the information requested.  */
+    if (executed != TX_NULL)
+    {
+
+        *executed =  executed_total;
+    }
+    if (stolen != TX_NULL)
+    {
+
+        *stolen =  stolen_total;
+    }
+    if (idle_count != TX_NULL)
+    {
+
+        *idle_count =  pool_ptr -> tx_job_pool_idle_count;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    tx_job_create                                       PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function initializes a job with its function and input. The    */
+/*    job is ready when it is submitted and the jobs it depends on are    */
+/*    complete. A job can be created again once it is complete.           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    job_ptr                           Pointer to job control block      */
+/*    job_function                      Job function                      */
+/*    job_input                         Input of the job function         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+UINT  tx_job_create(TX_JOB *job_ptr, VOID (*job_function)(TX_JOB *job_ptr, ULONG job_input), ULONG job_input)
+{
+
+    /* Check the job and its function.  */
+    if ((job_ptr == TX_NULL) || (job_function == TX_NULL))
+    {
+
+        return(TX_PTR_ERROR);
+    }
+
+    /* Initialize the job control block to all zeros.  */
+    TX_MEMSET(job_ptr, 0, (sizeof(TX_JOB)));
+
+    /* Setup the job function and input.  */
+    job_ptr -> tx_job_function =  job_function;
+    job_ptr -> tx_job_input =     job_input;
+
+    /* The job function is not complete and the job is not submitted.  */
+    job_ptr -> tx_job_unfinished =    ((ULONG) 1);
+    job_ptr -> tx_job_dependencies =  ((ULONG) 1);
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    tx_job_child_add                                    PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function makes a job the child of another job, which is not    */
+/*    complete before its child. This is called before the child is       */
+/*    submitted and before the parent is complete, typically by the job   */
+/*    function of the parent.                                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    parent_ptr                        Pointer to parent job             */
+/*    child_ptr                         Pointer to child job              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+UINT  tx_job_child_add(TX_JOB *parent_ptr, TX_JOB *child_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Check the jobs.  */
+    if ((parent_ptr == TX_NULL) || (child_ptr == TX_NULL) || (parent_ptr == child_ptr))
+    {
+
+        return(TX_PTR_ERROR);
+    }
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Determine if the parent is already complete or the child has a parent.  */
+    if ((parent_ptr -> tx_job_unfinished == ((ULONG) 0)) || (child_ptr -> tx_job_parent != TX_NULL))
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        return(TX_NOT_AVAILABLE);
+    }
+
+    /* The parent is not complete before the child.  */
+    parent_ptr -> tx_job_unfinished++;
+    child_ptr -> tx_job_parent =  parent_ptr;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    tx_job_depend                                       PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function delays a job until another job is complete. This is   */
+/*    called before the job is submitted. Nothing is done if the other    */
+/*    job is already complete.                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    job_ptr                           Pointer to job                    */
+/*    predecessor_ptr                   Pointer to the job to wait for    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+UINT  tx_job_depend(TX_JOB *job_ptr, TX_JOB *predecessor_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT            status;
+
+
+    /* Check the jobs.  */
+    if ((job_ptr == TX_NULL) || (predecessor_ptr == TX_NULL) || (job_ptr == predecessor_ptr))
+    {
+
+        return(TX_PTR_ERROR);
+    }
+
+    /* Default the status to TX_SUCCESS.  */
+    status =  TX_SUCCESS;
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Determine if the predecessor is not complete.  */
+    if (predecessor_ptr -> tx_job_unfinished != ((ULONG) 0))
+    {
+
+        /* Determine if there is room for another successor.  */
+        if (predecessor_ptr -> tx_job_successor_count < ((UINT) TX_JOB_MAX_SUCCESSORS))
+        {
+
+            /* Make the job wait for the predecessor.  */
+            predecessor_ptr -> tx_job_successors[predecessor_ptr -> tx_job_successor_count] =  job_ptr;
+            predecessor_ptr -> tx_job_successor_count++;
+            job_ptr -> tx_job_dependencies++;
+        }
+        else
+        {
+
+            /* Too many jobs depend on the predecessor.  */
+            status =  TX_SIZE_ERROR;
+        }
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return completion status.  */
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    tx_job_submit                                       PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function submits a job to a job pool. The job is placed in a   */
+/*    worker deque when the jobs it depends on are complete. A worker     */
+/*    places the job in its own deque, other threads spread their jobs    */
+/*    over the workers. When the deques are full, a worker runs the job   */
+/*    itself.                                                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to job pool control       */
+/*                                        block                           */
+/*    job_ptr                           Pointer to job                    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_job_pool_worker_get           Find the worker of the caller     */
+/*    _tx_job_pool_ready                Place job in a worker deque       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+UINT  tx_job_submit(TX_JOB_POOL *pool_ptr, TX_JOB *job_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_JOB_WORKER   *worker_ptr;
+UINT            status;
+
+
+    /* Check the job pool and the job.  */
+    if ((pool_ptr == TX_NULL) || (pool_ptr -> tx_job_pool_id != TX_JOB_POOL_ID) || (job_ptr == TX_NULL))
+    {
+
+        return(TX_PTR_ERROR);
+    }
+
+    /* Pickup the worker of the caller, if any.  */
+    worker_ptr =  _tx_job_pool_worker_get(pool_ptr);
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Determine if the job is created and not yet submitted.  */
+    if ((job_ptr -> tx_job_dependencies == ((ULONG) 0)) || (job_ptr -> tx_job_unfinished == ((ULONG) 0)))
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        return(TX_NOT_AVAILABLE);
+    }
+
+    /* The job is submitted.  */
+    job_ptr -> tx_job_dependencies--;
+
+    /* Determine if the job still waits for other jobs.  */
+    if (job_ptr -> tx_job_dependencies != ((ULONG) 0))
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* The job is placed in a deque when the last job it depends on is complete.  */
+        return(TX_SUCCESS);
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Place the job in a worker deque.  */
+    status =  _tx_job_pool_ready(pool_ptr, worker_ptr, job_ptr);
+
+    /* Determine if the deques are full.  */
+    if (status != TX_SUCCESS)
+    {
+
+        /* The job can be submitted again.  */
+        TX_DISABLE
+        job_ptr -> tx_job_dependencies++;
+        TX_RESTORE
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    tx_job_wait                                         PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function waits until a job is complete. A worker of the job    */
+/*    pool runs other jobs while it waits, other threads suspend. The     */
+/*    wait option applies to each suspension.                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to job pool control       */
+/*                                        block                           */
+/*    job_ptr                           Pointer to job                    */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_job_pool_worker_get           Find the worker of the caller     */
+/*    _tx_job_pool_take                 Take a job from a deque           */
+/*    _tx_job_execute                   Run a job                         */
+/*    tx_event_flags_get                Wait for the job                  */
+/*    tx_event_flags_set                Clear the event flag              */
+/*    tx_thread_relinquish              Wait for an event flag            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+UINT  tx_job_wait(TX_JOB_POOL *pool_ptr, TX_JOB *job_ptr, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_JOB_WORKER   *worker_ptr;
+TX_JOB          *next_job_ptr;
+ULONG           wait_flag;
+ULONG           free_flags;
+ULONG           actual_flags;
+UINT            status;
+
+
+    /* Check the job pool and the job.  */
+    if ((pool_ptr == TX_NULL) || (pool_ptr -> tx_job_pool_id != TX_JOB_POOL_ID) || (job_ptr == TX_NULL))
+    {
+
+        return(TX_PTR_ERROR);
+    }
+
+    /* Pickup the worker of the caller, if any.  */
+    worker_ptr =  _tx_job_pool_worker_get(pool_ptr);
+
+    /* Loop until the job is complete.  */
+    status =     TX_SUCCESS;
+    wait_flag =  ((ULONG) 0);
+    do
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Determine if the job is complete.  */
+        if (job_ptr -> tx_job_unfinished == ((ULONG) 0))
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            break;
+        }
+
+        /* A worker runs the other jobs while it waits.  */
+        next_job_ptr =  TX_NULL;
+        if (worker_ptr != TX_NULL)
+        {
+
+            next_job_ptr =  _tx_job_pool_take(pool_ptr, worker_ptr);
+        }
+
+        /* Determine if the thread must suspend and has no event flag yet.  */
+        if ((next_job_ptr == TX_NULL) && (wait_flag == ((ULONG) 0)))
+        {
+
+            /* Pickup the lowest free event flag.  */
+            free_flags =  ~(pool_ptr -> tx_job_pool_wait_flags);
+            wait_flag =   free_flags & ((~free_flags) + ((ULONG) 1));
+            pool_ptr -> tx_job_pool_wait_flags =  pool_ptr -> tx_job_pool_wait_flags | wait_flag;
+        }
+
+        /* Ask for the event flag when the job is complete.  */
+        job_ptr -> tx_job_wait_flag =  job_ptr -> tx_job_wait_flag | wait_flag;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Determine if there is a job to run.  */
+        if (next_job_ptr != TX_NULL)
+        {
+
+            /* Run the job.  */
+            _tx_job_execute(pool_ptr, worker_ptr, next_job_ptr);
+        }
+        else if (wait_flag == ((ULONG) 0))
+        {
+
+            /* All the event flags are used, try again later.  */
+            tx_thread_relinquish();
+        }
+        else
+        {
+
+            /* Wait for the job to complete.  */
+            status =  tx_event_flags_get(&pool_ptr -> tx_job_pool_events, wait_flag, TX_OR_CLEAR, &actual_flags, wait_option);
+        }
+
+    } while (status == TX_SUCCESS);
+
+    /* Determine if an event flag was used.  */
+    if (wait_flag != ((ULONG) 0))
+    {
+
+        /* Release the event flag.  */
+        TX_DISABLE
+        job_ptr -> tx_job_wait_flag =  job_ptr -> tx_job_wait_flag & ~wait_flag;
+        pool_ptr -> tx_job_pool_wait_flags =  pool_ptr -> tx_job_pool_wait_flags & ~wait_flag;
+        TX_RESTORE
+
+        /* Clear the event flag, which may be set after the job was found complete.  */
+        if (status == TX_SUCCESS)
+        {
+
+            tx_event_flags_set(&pool_ptr -> tx_job_pool_events, ~wait_flag, TX_AND);
+        }
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_job_pool_worker_get                             PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function finds the worker of the job pool that is the current  */
+/*    thread.                                                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to job pool control       */
+/*                                        block                           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    worker_ptr                        Worker of the current thread,     */
+/*                                        TX_NULL if the current thread   */
+/*                                        is not a worker                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_thread_identify                Pickup the current thread         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    tx_job_pool_delete                Delete a job pool                 */
+/*    tx_job_submit                     Submit a job                      */
+/*    tx_job_wait                       Wait for a job                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+TX_JOB_WORKER  *_tx_job_pool_worker_get(TX_JOB_POOL *pool_ptr)
+{
+
+TX_THREAD       *thread_ptr;
+UINT            index;
+
+
+    /* Pickup the current thread.  */
+    thread_ptr =  tx_thread_identify();
+
+    /* Look for the worker of the thread.  */
+    for (index = ((UINT) 0); index < pool_ptr -> tx_job_pool_worker_count; index++)
+    {
+
+        if (thread_ptr == &pool_ptr -> tx_job_pool_workers[index].tx_job_worker_thread)
+        {
+
+            return(&pool_ptr -> tx_job_pool_workers[index]);
+        }
+    }
+
+    /* The current thread is not a worker of the job pool.  */
+    return(TX_NULL);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_job_pool_take                                   PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function takes the next job of a worker, the newest job of     */
+/*    its own deque, or else the oldest job stolen from the deque of      */
+/*    another worker. This function is called with interrupts disabled.   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to job pool control       */
+/*                                        block                           */
+/*    worker_ptr                        Pointer to worker                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    job_ptr                           Job to run, TX_NULL if all the    */
+/*                                        deques are empty                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_job_pool_worker_entry         Worker thread                     */
+/*    tx_job_wait                       Wait for a job                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+TX_JOB  *_tx_job_pool_take(TX_JOB_POOL *pool_ptr, TX_JOB_WORKER *worker_ptr)
+{
+
+TX_JOB_WORKER   *victim_ptr;
+TX_JOB          *job_ptr;
+UINT            worker_index;
+UINT            index;
+
+
+    /* Determine if the worker has a job in its deque.  */
+    if (worker_ptr -> tx_job_worker_bottom != worker_ptr -> tx_job_worker_top)
+    {
+
+        /* Take the newest job of the deque.  */
+        worker_ptr -> tx_job_worker_bottom--;
+        job_ptr =  worker_ptr -> tx_job_worker_deque[worker_ptr -> tx_job_worker_bottom & TX_JOB_POOL_DEQUE_MASK];
+
+        return(job_ptr);
+    }
+
+    /* Look at the deques of the other workers, starting with the next worker.  */
+    worker_index =  (UINT) (worker_ptr - pool_ptr -> tx_job_pool_workers);
+    for (index = ((UINT) 1); index < pool_ptr -> tx_job_pool_worker_count; index++)
+    {
+
+        /* Pickup the next worker.  */
+        worker_index++;
+        if (worker_index == pool_ptr -> tx_job_pool_worker_count)
+        {
+
+            worker_index =  ((UINT) 0);
+        }
+        victim_ptr =  &pool_ptr -> tx_job_pool_workers[worker_index];
+
+        /* Determine if the worker has a job in its deque.  */
+        if (victim_ptr -> tx_job_worker_bottom != victim_ptr -> tx_job_worker_top)
+        {
+
+            /* Steal the oldest job of the deque.  */
+            job_ptr =  victim_ptr -> tx_job_worker_deque[victim_ptr -> tx_job_worker_top & TX_JOB_POOL_DEQUE_MASK];
+            victim_ptr -> tx_job_worker_top++;
+            worker_ptr -> tx_job_worker_stolen++;
+
+            return(job_ptr);
+        }
+    }
+
+    /* All the deques are empty.  */
+    return(TX_NULL);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_job_pool_ready                                  PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places a ready job at the bottom of the deque of the  */
+/*    worker, or of the next worker if the caller is not a worker, and    */
+/*    wakes up an idle worker. When all the deques are full, a worker     */
+/*    runs the job itself.                                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to job pool control       */
+/*                                        block                           */
+/*    worker_ptr                        Pointer to the worker of the      */
+/*                                        caller, TX_NULL if the caller   */
+/*                                        is not a worker                 */
+/*    job_ptr                           Pointer to job                    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_job_execute                   Run a job                         */
+/*    tx_semaphore_put                  Wake up an idle worker            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    tx_job_submit                     Submit a job                      */
+/*    _tx_job_complete                  Complete a job                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_job_pool_ready(TX_JOB_POOL *pool_ptr, TX_JOB_WORKER *worker_ptr, TX_JOB *job_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_JOB_WORKER   *target_ptr;
+UINT            worker_index;
+UINT            index;
+UINT            placed;
+UINT            wake;
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Pickup the first worker to try, the worker of the caller or the next one.  */
+    if (worker_ptr != TX_NULL)
+    {
+
+        worker_index =  (UINT) (worker_ptr - pool_ptr -> tx_job_pool_workers);
+    }
+    else
+    {
+
+        worker_index =  pool_ptr -> tx_job_pool_next_worker;
+        pool_ptr -> tx_job_pool_next_worker =  (worker_index + ((UINT) 1)) % pool_ptr -> tx_job_pool_worker_count;
+    }
+
+    /* Place the job in the first deque with room.  */
+    placed =  TX_FALSE;
+    for (index = ((UINT) 0); (index < pool_ptr -> tx_job_pool_worker_count) && (placed == TX_FALSE); index++)
+    {
+
+        target_ptr =  &pool_ptr -> tx_job_pool_workers[worker_index];
+        if ((target_ptr -> tx_job_worker_bottom - target_ptr -> tx_job_worker_top) < ((ULONG) TX_JOB_POOL_DEQUE_SIZE))
+        {
+
+            target_ptr -> tx_job_worker_deque[target_ptr -> tx_job_worker_bottom & TX_JOB_POOL_DEQUE_MASK] =  job_ptr;
+            target_ptr -> tx_job_worker_bottom++;
+            placed =  TX_TRUE;
+        }
+
+        /* Move to the next worker.  */
+        worker_index =  (worker_index + ((UINT) 1)) % pool_ptr -> tx_job_pool_worker_count;
+    }
+
+    /* Determine if an idle worker must be woken up.  */
+    wake =  TX_FALSE;
+    if ((placed == TX_TRUE) && (pool_ptr -> tx_job_pool_idle_count != ((ULONG) 0)))
+    {
+
+        pool_ptr -> tx_job_pool_idle_count--;
+        wake =  TX_TRUE;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Determine if the job was not placed.  */
+    if (placed == TX_FALSE)
+    {
+
+        /* Only a worker can run the job itself.  */
+        if (worker_ptr == TX_NULL)
+        {
+
+            return(TX_QUEUE_FULL);
+        }
+
+        /* Run the job.  */
+        _tx_job_execute(pool_ptr, worker_ptr, job_ptr);
+    }
+    else if (wake == TX_TRUE)
+    {
+
+        /* Wake up an idle worker.  */
+        tx_semaphore_put(&pool_ptr -> tx_job_pool_semaphore);
+    }
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_job_execute                                     PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function runs a job function, then completes the job function  */
+/*    part of the job.                                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to job pool control       */
+/*                                        block                           */
+/*    worker_ptr                        Pointer to the worker running     */
+/*                                        the job                         */
+/*    job_ptr                           Pointer to job                    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    (tx_job_function)                 Job function                      */
+/*    _tx_job_complete                  Complete a job                    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_job_pool_worker_entry         Worker thread                     */
+/*    _tx_job_pool_ready                Place job in a worker deque       */
+/*    tx_job_wait                       Wait for a job                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_job_execute(TX_JOB_POOL *pool_ptr, TX_JOB_WORKER *worker_ptr, TX_JOB *job_ptr)
+{
+
+    /* Count the job.  */
+    worker_ptr -> tx_job_worker_executed++;
+
+    /* Run the job function.  */
+    (job_ptr -> tx_job_function)(job_ptr, job_ptr -> tx_job_input);
+
+    /* The job function is complete.  */
+    _tx_job_complete(pool_ptr, worker_ptr, job_ptr);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_job_complete                                    PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function completes one part of a job. When the job is          */
+/*    complete, this function sets the event flags of the waiting         */
+/*    threads, places the jobs that depend on it and are ready in the     */
+/*    deque of the worker, and completes the child part of its parent.    */
+/*    The job is not used after it is complete, it may be created again   */
+/*    right away.                                                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to job pool control       */
+/*                                        block                           */
+/*    worker_ptr                        Pointer to the worker running     */
+/*                                        the job                         */
+/*    job_ptr                           Pointer to job                    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_event_flags_set                Resume the waiting threads        */
+/*    _tx_job_pool_ready                Place job in a worker deque       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_job_execute                   Run a job                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_job_complete(TX_JOB_POOL *pool_ptr, TX_JOB_WORKER *worker_ptr, TX_JOB *job_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_JOB          *ready_jobs[TX_JOB_MAX_SUCCESSORS];
+TX_JOB          *successor_ptr;
+UINT            ready_count;
+UINT            index;
+ULONG           wait_flag;
+
+
+    /* Loop to complete the job and its parents.  */
+    while (job_ptr != TX_NULL)
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Determine if the job is complete.  */
+        job_ptr -> tx_job_unfinished--;
+        if (job_ptr -> tx_job_unfinished != ((ULONG) 0))
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            break;
+        }
+
+        /* Pickup the event flags of the waiting threads.  */
+        wait_flag =  job_ptr -> tx_job_wait_flag;
+
+        /* Find the jobs that depend on this job and are now ready.  */
+        ready_count =  ((UINT) 0);
+        for (index = ((UINT) 0); index < job_ptr -> tx_job_successor_count; index++)
+        {
+
+            successor_ptr =  job_ptr -> tx_job_successors[index];
+            successor_ptr -> tx_job_dependencies--;
+            if (successor_ptr -> tx_job_dependencies == ((ULONG) 0))
+            {
+
+                ready_jobs[ready_count] =  successor_ptr;
+                ready_count++;
+            }
+        }
+
+        /* Pickup the parent, the job is no longer used after this point.  */
+        job_ptr =  job_ptr -> tx_job_parent;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Resume the threads waiting for the job.  */
+        if (wait_flag != ((ULONG) 0))
+        {
+
+            tx_event_flags_set(&pool_ptr -> tx_job_pool_events, wait_flag, TX_OR);
+        }
+
+        /* Place the ready jobs in the deque of the worker.  */
+        for (index = ((UINT) 0); index < ready_count; index++)
+        {
+
+            _tx_job_pool_ready(pool_ptr, worker_ptr, ready_jobs[index]);
+        }
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_job_pool_worker_entry                           PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is the entry of the worker threads. A worker runs     */
+/*    the jobs of its deque, steals the jobs of the other workers when    */
+/*    its deque is empty, and suspends on the job pool semaphore when     */
+/*    all the deques are empty.                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    worker_input                      Index of the worker               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_thread_identify                Pickup the current thread         */
+/*    _tx_job_pool_take                 Take a job from a deque           */
+/*    _tx_job_execute                   Run a job                         */
+/*    tx_semaphore_get                  Wait for a job                    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    ThreadX Scheduler                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_job_pool_worker_entry(ULONG worker_input)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_JOB_WORKER   *worker_ptr;
+TX_JOB_POOL     *pool_ptr;
+TX_JOB          *job_ptr;
+UINT            status;
+
+
+    /* The worker thread is the first member of the worker control block.  */
+    TX_PARAMETER_NOT_USED(worker_input);
+    worker_ptr =  (TX_JOB_WORKER *) ((VOID *) tx_thread_identify());
+    pool_ptr =    worker_ptr -> tx_job_worker_pool;
+
+    /* Loop to run the jobs.  */
+    status =  TX_SUCCESS;
+    while (status == TX_SUCCESS)
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Take the next job, or become idle.  */
+        job_ptr =  _tx_job_pool_take(pool_ptr, worker_ptr);
+        if (job_ptr == TX_NULL)
+        {
+
+            pool_ptr -> tx_job_pool_idle_count++;
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Determine if there is a job to run.  */
+        if (job_ptr != TX_NULL)
+        {
+
+            /* Run the job.  */
+            _tx_job_execute(pool_ptr, worker_ptr, job_ptr);
+        }
+        else
+        {
+
+            /* Wait for a job to be placed in a deque.  */
+            status =  tx_semaphore_get(&pool_ptr -> tx_job_pool_semaphore, TX_WAIT_FOREVER);
+        }
+    }
+}
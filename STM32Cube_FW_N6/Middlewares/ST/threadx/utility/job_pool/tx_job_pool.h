@@ -0,0 +1,192 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Job Pool                                                            */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  COMPONENT DEFINITION                                   RELEASE        */
+/*                                                                        */
+/*    tx_job_pool.h                                       PORTABLE C      */
+/*                                                           6.4.0        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    STMicroelectronics                                                  */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file defines the job pool, a fixed set of worker threads that  */
+/*    run small jobs. Each worker has a deque of ready jobs, runs its own */
+/*    jobs last in first out and steals the oldest jobs of the other      */
+/*    workers when it has none. Jobs can have child jobs, which complete  */
+/*    their parent, and dependencies, which delay them until other jobs   */
+/*    are complete. All the memory is provided by the application.        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     STMicroelectronics       Initial Version 6.4.0         */
+/*                                                                        */
+/**************************************************************************/
+
+#ifndef TX_JOB_POOL_H
+#define TX_JOB_POOL_H
+
+
+/* Determine if a C++ compiler is being used.  If so, ensure that standard
+   C is used to process the API information.  */
+
+#ifdef __cplusplus
+
+/* Yes, C++ compiler is present.  Use standard C.  */
+extern   "C" {
+
+#endif
+
+
+/* Define the number of job pointers in the deque of each worker, a power of 2.  */
+
+#ifndef TX_JOB_POOL_DEQUE_SIZE
+#define TX_JOB_POOL_DEQUE_SIZE          64
+#endif
+
+
+/* Define the maximum number of jobs that can depend on a job.  */
+
+#ifndef TX_JOB_MAX_SUCCESSORS
+#define TX_JOB_MAX_SUCCESSORS           4
+#endif
+
+
+/* Define the job pool ID.  */
+
+#define TX_JOB_POOL_ID                  ((ULONG) 0x4A4F4250)
+
+
+/* Define the job control block. A job is complete when its function has returned
+   and all its child jobs are complete.  */
+
+typedef struct TX_JOB_STRUCT
+{
+
+    /* Define the job function and its input.  */
+    VOID                (*tx_job_function)(struct TX_JOB_STRUCT *job_ptr, ULONG job_input);
+    ULONG               tx_job_input;
+
+    /* Define the parent job, which is not complete before this job.  */
+    struct TX_JOB_STRUCT
+                        *tx_job_parent;
+
+    /* Define the number of parts of the job not complete: the job function and
+       each child job.  */
+    ULONG               tx_job_unfinished;
+
+    /* Define the number of conditions before the job is ready: the submit and each
+       job it depends on.  */
+    ULONG               tx_job_dependencies;
+
+    /* Define the jobs that depend on this job.  */
+    struct TX_JOB_STRUCT
+                        *tx_job_successors[TX_JOB_MAX_SUCCESSORS];
+    UINT                tx_job_successor_count;
+
+    /* Define the event flag set when the job is complete, if a thread waits for it.  */
+    ULONG               tx_job_wait_flag;
+
+    /* Define a pointer for the application.  */
+    VOID                *tx_job_user_ptr;
+} TX_JOB;
+
+
+/* Define the worker control block.  */
+
+typedef struct TX_JOB_WORKER_STRUCT
+{
+
+    /* Define the worker thread.  */
+    TX_THREAD           tx_job_worker_thread;
+
+    /* Define the pool of the worker.  */
+    struct TX_JOB_POOL_STRUCT
+                        *tx_job_worker_pool;
+
+    /* Define the deque of ready jobs. The worker takes its jobs at the bottom, the
+       other workers steal them at the top.  */
+    TX_JOB              *tx_job_worker_deque[TX_JOB_POOL_DEQUE_SIZE];
+    ULONG               tx_job_worker_top;
+    ULONG               tx_job_worker_bottom;
+
+    /* Define the number of jobs run and the number of them stolen.  */
+    ULONG               tx_job_worker_executed;
+    ULONG               tx_job_worker_stolen;
+} TX_JOB_WORKER;
+
+
+/* Define the job pool control block.  */
+
+typedef struct TX_JOB_POOL_STRUCT
+{
+
+    /* Define the job pool ID used for error checking.  */
+    ULONG               tx_job_pool_id;
+
+    /* Define the job pool's name.  */
+    CHAR                *tx_job_pool_name;
+
+    /* Define the workers.  */
+    TX_JOB_WORKER       *tx_job_pool_workers;
+    UINT                tx_job_pool_worker_count;
+
+    /* Define the next worker given a job submitted by another thread.  */
+    UINT                tx_job_pool_next_worker;
+
+    /* Define the number of workers waiting for a job, and the semaphore they wait on.  */
+    ULONG               tx_job_pool_idle_count;
+    TX_SEMAPHORE        tx_job_pool_semaphore;
+
+    /* Define the event flags of the threads waiting for jobs, one flag each.  */
+    TX_EVENT_FLAGS_GROUP
+                        tx_job_pool_events;
+    ULONG               tx_job_pool_wait_flags;
+} TX_JOB_POOL;
+
+
+/* Declare the job pool function prototypes.  */
+
+UINT    tx_job_pool_create(TX_JOB_POOL *pool_ptr, CHAR *name_ptr, TX_JOB_WORKER *workers, UINT worker_count,
+                VOID *stack_start, ULONG stack_size, UINT priority);
+UINT    tx_job_pool_delete(TX_JOB_POOL *pool_ptr);
+UINT    tx_job_pool_info_get(TX_JOB_POOL *pool_ptr, ULONG *executed, ULONG *stolen, ULONG *idle_count);
+UINT    tx_job_create(TX_JOB *job_ptr, VOID (*job_function)(TX_JOB *job_ptr, ULONG job_input), ULONG job_input);
+UINT    tx_job_child_add(TX_JOB *parent_ptr, TX_JOB *child_ptr);
+UINT    tx_job_depend(TX_JOB *job_ptr, TX_JOB *predecessor_ptr);
+UINT    tx_job_submit(TX_JOB_POOL *pool_ptr, TX_JOB *job_ptr);
+UINT    tx_job_wait(TX_JOB_POOL *pool_ptr, TX_JOB *job_ptr, ULONG wait_option);
+
+
+/* Determine if a C++ compiler is being used.  If so, complete the standard
+   C conditional started above.  */
+#ifdef __cplusplus
+        }
+#endif
+
+#endif
@@ -0,0 +1,274 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Job Pool Parallel For Benchmark                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* This benchmark runs the same parallel for over an array with 1 worker, then with
+   TX_JOB_POOL_BENCHMARK_WORKERS workers, and prints the time of each run in ticks, the
+   number of jobs stolen and the speedup. The parallel for splits its range in two child
+   jobs until the range is TX_JOB_POOL_BENCHMARK_GRAIN elements or less. Each element is
+   computed with a loop of multiply-accumulate operations, similar to a small filter.
+
+   It is built with the ThreadX library, tx_job_pool.c and the application define below,
+   for example with the SMP Linux port.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "tx_api.h"
+#include "tx_job_pool.h"
+
+
+/* Define the benchmark parameters, which can be changed with -D compiler options.  */
+
+#ifndef TX_JOB_POOL_BENCHMARK_WORKERS
+#ifdef TX_THREAD_SMP_MAX_CORES
+#define TX_JOB_POOL_BENCHMARK_WORKERS   TX_THREAD_SMP_MAX_CORES
+#else
+#define TX_JOB_POOL_BENCHMARK_WORKERS   4
+#endif
+#endif
+
+#ifndef TX_JOB_POOL_BENCHMARK_ELEMENTS
+#define TX_JOB_POOL_BENCHMARK_ELEMENTS  65536
+#endif
+
+#ifndef TX_JOB_POOL_BENCHMARK_GRAIN
+#define TX_JOB_POOL_BENCHMARK_GRAIN     512
+#endif
+
+#ifndef TX_JOB_POOL_BENCHMARK_TAPS
+#define TX_JOB_POOL_BENCHMARK_TAPS      256
+#endif
+
+#ifndef TX_JOB_POOL_BENCHMARK_REPEAT
+#define TX_JOB_POOL_BENCHMARK_REPEAT    20
+#endif
+
+#define TX_JOB_POOL_BENCHMARK_STACK     4096
+#define TX_JOB_POOL_BENCHMARK_JOBS      ((2 * ((TX_JOB_POOL_BENCHMARK_ELEMENTS + TX_JOB_POOL_BENCHMARK_GRAIN - 1) / TX_JOB_POOL_BENCHMARK_GRAIN)) + 1)
+
+
+/* Define the benchmark data.  */
+
+TX_THREAD       benchmark_thread;
+ULONG           benchmark_thread_stack[TX_JOB_POOL_BENCHMARK_STACK / sizeof(ULONG)];
+
+TX_JOB_POOL     benchmark_pool;
+TX_JOB_WORKER   benchmark_workers[TX_JOB_POOL_BENCHMARK_WORKERS];
+ULONG           benchmark_worker_stacks[TX_JOB_POOL_BENCHMARK_WORKERS][TX_JOB_POOL_BENCHMARK_STACK / sizeof(ULONG)];
+
+TX_JOB          benchmark_jobs[TX_JOB_POOL_BENCHMARK_JOBS];
+ULONG           benchmark_job_first[TX_JOB_POOL_BENCHMARK_JOBS];
+ULONG           benchmark_job_elements[TX_JOB_POOL_BENCHMARK_JOBS];
+ULONG           benchmark_job_count;
+
+ULONG           benchmark_input[TX_JOB_POOL_BENCHMARK_ELEMENTS];
+ULONG           benchmark_output[TX_JOB_POOL_BENCHMARK_ELEMENTS];
+
+
+/* Define the function prototypes.  */
+
+VOID            benchmark_thread_entry(ULONG thread_input);
+VOID            benchmark_range_job(TX_JOB *job_ptr, ULONG job_input);
+ULONG           benchmark_run(UINT workers, ULONG *checksum, ULONG *stolen);
+
+
+/* Define main entry point.  */
+
+int main(void)
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+
+    return(0);
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+    TX_PARAMETER_NOT_USED(first_unused_memory);
+
+    /* Create the benchmark thread, at a lower priority than the workers.  */
+    tx_thread_create(&benchmark_thread, "benchmark thread", benchmark_thread_entry, 0,
+            benchmark_thread_stack, sizeof(benchmark_thread_stack),
+            20, 20, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+/* Compute a range of elements, or split it in two child jobs.  */
+
+VOID    benchmark_range_job(TX_JOB *job_ptr, ULONG job_input)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+ULONG   child;
+ULONG   first;
+ULONG   count;
+ULONG   half;
+ULONG   element;
+ULONG   tap;
+ULONG   accumulator;
+
+
+    /* The input is the index of the job, which selects its range of elements.  */
+    first =  benchmark_job_first[job_input];
+    count =  benchmark_job_elements[job_input];
+
+    /* Determine if the range is small enough to be computed.  */
+    if (count <= TX_JOB_POOL_BENCHMARK_GRAIN)
+    {
+
+        for (element = first; element < (first + count); element++)
+        {
+
+            /* Filter the input around the element.  */
+            accumulator =  0;
+            for (tap = 0; tap < TX_JOB_POOL_BENCHMARK_TAPS; tap++)
+            {
+
+                accumulator =  accumulator + (benchmark_input[(element + tap) % TX_JOB_POOL_BENCHMARK_ELEMENTS] * (tap + 1));
+            }
+            benchmark_output[element] =  accumulator;
+        }
+        return;
+    }
+
+    /* Split the range in two child jobs.  */
+    half =  count / 2;
+    TX_DISABLE
+    child =  benchmark_job_count;
+    benchmark_job_count =  benchmark_job_count + 2;
+    TX_RESTORE
+
+    benchmark_job_first[child] =         first;
+    benchmark_job_elements[child] =      half;
+    benchmark_job_first[child + 1] =     first + half;
+    benchmark_job_elements[child + 1] =  count - half;
+    tx_job_create(&benchmark_jobs[child], benchmark_range_job, child);
+    tx_job_create(&benchmark_jobs[child + 1], benchmark_range_job, child + 1);
+    tx_job_child_add(job_ptr, &benchmark_jobs[child]);
+    tx_job_child_add(job_ptr, &benchmark_jobs[child + 1]);
+    tx_job_submit(&benchmark_pool, &benchmark_jobs[child]);
+    tx_job_submit(&benchmark_pool, &benchmark_jobs[child + 1]);
+}
+
+
+/* Run the parallel for with the specified number of workers.  */
+
+ULONG   benchmark_run(UINT workers, ULONG *checksum, ULONG *stolen)
+{
+
+ULONG   start_time;
+ULONG   element;
+UINT    repeat;
+
+
+    /* Create the job pool.  */
+    tx_job_pool_create(&benchmark_pool, "benchmark pool", benchmark_workers, workers,
+            benchmark_worker_stacks, sizeof(benchmark_worker_stacks[0]), 10);
+
+    /* Run the parallel for several times.  */
+    start_time =  tx_time_get();
+    for (repeat = 0; repeat < TX_JOB_POOL_BENCHMARK_REPEAT; repeat++)
+    {
+
+        /* The first job covers all the elements.  */
+        benchmark_job_count =  1;
+        benchmark_job_first[0] =     0;
+        benchmark_job_elements[0] =  TX_JOB_POOL_BENCHMARK_ELEMENTS;
+        tx_job_create(&benchmark_jobs[0], benchmark_range_job, 0);
+        tx_job_submit(&benchmark_pool, &benchmark_jobs[0]);
+        tx_job_wait(&benchmark_pool, &benchmark_jobs[0], TX_WAIT_FOREVER);
+    }
+    start_time =  tx_time_get() - start_time;
+
+    /* Check the output.  */
+    *checksum =  0;
+    for (element = 0; element < TX_JOB_POOL_BENCHMARK_ELEMENTS; element++)
+    {
+
+        *checksum =  (*checksum * 31) + benchmark_output[element];
+        benchmark_output[element] =  0;
+    }
+
+    /* Pickup the number of jobs stolen and delete the job pool.  */
+    tx_job_pool_info_get(&benchmark_pool, TX_NULL, stolen, TX_NULL);
+    tx_job_pool_delete(&benchmark_pool);
+
+    return(start_time);
+}
+
+
+/* Define the benchmark thread.  */
+
+VOID    benchmark_thread_entry(ULONG thread_input)
+{
+
+ULONG   element;
+ULONG   serial_time;
+ULONG   serial_checksum;
+ULONG   parallel_time;
+ULONG   parallel_checksum;
+ULONG   stolen;
+
+
+    TX_PARAMETER_NOT_USED(thread_input);
+
+    /* Setup the input.  */
+    for (element = 0; element < TX_JOB_POOL_BENCHMARK_ELEMENTS; element++)
+    {
+
+        benchmark_input[element] =  (element * ((ULONG) 2654435761UL)) >> 7;
+    }
+
+    printf("**** Job Pool Parallel For Benchmark **** %u elements, grain %u, %u taps, %u runs\n",
+           (UINT) TX_JOB_POOL_BENCHMARK_ELEMENTS, (UINT) TX_JOB_POOL_BENCHMARK_GRAIN,
+           (UINT) TX_JOB_POOL_BENCHMARK_TAPS, (UINT) TX_JOB_POOL_BENCHMARK_REPEAT);
+
+    /* Run with one worker, then with all the workers.  */
+    serial_time =  benchmark_run(1, &serial_checksum, &stolen);
+    printf("Workers:  1  Time: %lu ticks\n", (unsigned long) serial_time);
+    parallel_time =  benchmark_run(TX_JOB_POOL_BENCHMARK_WORKERS, &parallel_checksum, &stolen);
+    printf("Workers: %2u  Time: %lu ticks  Jobs stolen: %lu\n", (UINT) TX_JOB_POOL_BENCHMARK_WORKERS,
+           (unsigned long) parallel_time, (unsigned long) stolen);
+
+    /* Check the results are the same.  */
+    if (serial_checksum != parallel_checksum)
+    {
+
+        printf("ERROR: Invalid output with %u workers\n", (UINT) TX_JOB_POOL_BENCHMARK_WORKERS);
+    }
+    else if (parallel_time != 0)
+    {
+
+        printf("Speedup: %lu.%02lu\n", (unsigned long) (serial_time / parallel_time),
+               (unsigned long) (((serial_time % parallel_time) * 100) / parallel_time));
+    }
+
+#ifdef TX_JOB_POOL_BENCHMARK_EXIT
+    exit(0);
+#endif
+}
@@ -271,7 +271,7 @@ ULONG   tx_low_power_adjust_ticks;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _tx_timer_wheel_next_get          Timing wheel next expiration      */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -294,6 +294,9 @@ TX_TIMER_INTERNAL           *next_timer;
 UINT                        i;
 ULONG                       calculated_time;
 ULONG                       expiration_time = (ULONG) 0xFFFFFFFF;
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+ULONG                       wheel_ticks;
+#endif
 
 
     /* Disable interrupts.  */
@@ -315,6 +318,15 @@ ULONG                       expiration_time = (ULONG) 0xFFFFFFFF;
             /* Loop through the timers active for this relative time slot (determined by i).  */
             do
             {
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+                /* Skip the wheel timer, the timers on the wheel are looked at below.  */
+                if (next_timer == &(_tx_timer_wheel_timer.tx_timer_internal))
+                {
+                    /* Calculate an expiration time that is never a new minimum.  */
+                    calculated_time =  expiration_time;
+                }
+                else
+#endif
                 /* Determine if the remaining time is larger than the list.  */
                 if (next_timer -> tx_timer_internal_remaining_ticks > TX_TIMER_ENTRIES)
                 {
@@ -351,6 +363,22 @@ ULONG                       expiration_time = (ULONG) 0xFFFFFFFF;
         }
     }
 
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+    /* Determine if a timer on the timing wheel expires first.  */
+    if (_tx_timer_wheel_next_get(&wheel_ticks) == TX_TRUE)
+    {
+        /* Calculate the expiration time minus 1 tick.  */
+        calculated_time =  wheel_ticks - 1;
+
+        /* Determine if a new minimum expiration time is present.  */
+        if (expiration_time > calculated_time)
+        {
+            /* Yes, a new minimum expiration time is present - remember it!  */
+            expiration_time =  calculated_time;
+        }
+    }
+#endif
+
     /* Restore interrupts.  */
     TX_RESTORE
 
@@ -398,6 +426,9 @@ ULONG                       expiration_time = (ULONG) 0xFFFFFFFF;
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _tx_timer_system_activate         Timer activate service            */
+/*    _tx_timer_system_deactivate       Timer deactivate service          */
+/*    _tx_timer_wheel_boundary_get      Ticks to the next wheel timer     */
+/*                                        expiration                      */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -418,6 +449,9 @@ UINT                        i;
 TX_TIMER_INTERNAL           **timer_list_head;
 TX_TIMER_INTERNAL           *next_timer;
 TX_TIMER_INTERNAL           *temp_list_head;
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+ULONG                       wheel_ticks;
+#endif
 
 
     /* Determine if there is any time increment.  */
@@ -447,6 +481,13 @@ TX_TIMER_INTERNAL           *temp_list_head;
         }
     }
 
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+    /* Pickup the ticks to the next wheel timer expiration and stop the wheel timer,
+       it is started again when the timers of the wheel are reinserted.  */
+    wheel_ticks =  _tx_timer_wheel_boundary_get();
+    _tx_timer_system_deactivate(&(_tx_timer_wheel_timer.tx_timer_internal));
+#endif
+
     /* Calculate the proper place to position the timer.  */
     timer_list_head =  _tx_timer_current_ptr;
 
@@ -518,6 +559,52 @@ TX_TIMER_INTERNAL           *temp_list_head;
         }
     }
 
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+    /* Loop to pull all timers off the timing wheel as well.  */
+    for (i = 0; i < TX_TIMER_WHEEL_SLOTS; i++)
+    {
+        /* Determine if there is a timer list in this slot.  */
+        if (_tx_timer_wheel[i])
+        {
+            /* Setup the pointer to the expiration list.  */
+            next_timer =  _tx_timer_wheel[i];
+
+            /* Loop through the timers of this slot.  */
+            do
+            {
+                /* Convert the expiration time on the wheel to the remaining time.  */
+                next_timer -> tx_timer_internal_remaining_ticks =
+                                (next_timer -> tx_timer_internal_remaining_ticks - _tx_timer_wheel_time) + wheel_ticks;
+
+                /* Move to the next entry in the timer list.  */
+                next_timer =  next_timer -> tx_timer_internal_active_next;
+
+            } while (next_timer != _tx_timer_wheel[i]);
+
+            /* NULL terminate the slot timer list.  */
+            (_tx_timer_wheel[i] -> tx_timer_internal_active_previous) -> tx_timer_internal_active_next =  TX_NULL;
+
+            /* Yes, determine if the temporary list is NULL.  */
+            if (temp_list_head == TX_NULL)
+            {
+                /* First item on the list.  Move the entire linked list.  */
+                temp_list_head =  _tx_timer_wheel[i];
+            }
+            else
+            {
+                /* No, the temp list already has timers on it. Link the slot timer list to the end.  */
+                (temp_list_head -> tx_timer_internal_active_previous) -> tx_timer_internal_active_next =  _tx_timer_wheel[i];
+
+                /* Now update the previous to the new list's previous timer pointer.  */
+                temp_list_head -> tx_timer_internal_active_previous =  _tx_timer_wheel[i] -> tx_timer_internal_active_previous;
+            }
+
+            /* Now clear the slot head pointer.  */
+            _tx_timer_wheel[i] =  TX_NULL;
+        }
+    }
+#endif
+
     /* Set the current timer pointer to the beginning of the list.  */
     _tx_timer_current_ptr =  _tx_timer_list_start;
 
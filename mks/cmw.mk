@@ -16,9 +16,12 @@ C_SOURCES_CMW += $(CMW_REL_DIR)/sensors/vd6g/vd6g.c
 C_SOURCES_CMW += $(CMW_REL_DIR)/sensors/cmw_vd1941.c
 C_SOURCES_CMW += $(CMW_REL_DIR)/sensors/vd1941/vdx941.c
 C_SOURCES_CMW += $(ISP_REL_DIR)/isp/Src/isp_algo.c
+C_SOURCES_CMW += $(ISP_REL_DIR)/isp/Src/isp_algo_cct.c
 C_SOURCES_CMW += $(ISP_REL_DIR)/isp/Src/isp_cmd_parser.c
 C_SOURCES_CMW += $(ISP_REL_DIR)/isp/Src/isp_core.c
 C_SOURCES_CMW += $(ISP_REL_DIR)/isp/Src/isp_services.c
+C_SOURCES_CMW += $(ISP_REL_DIR)/isp/Src/isp_threadx.c
+C_SOURCES_CMW += $(ISP_REL_DIR)/isp/Src/isp_tool_frame.c
 C_SOURCES_CMW += $(ISP_REL_DIR)/isp/Src/isp_tool_com.c
 C_INCLUDES_CMW += -I$(CMW_REL_DIR)
 C_INCLUDES_CMW += -I$(CMW_REL_DIR)/sensors